@@ -3,15 +3,14 @@
 
 #include "Components/ACFAIManagerComponent.h"
 #include "ACFAITypes.h"
+#include <Engine/World.h>
+#include <GameFramework/Controller.h>
 
 // Sets default values for this component's properties
 UACFAIManagerComponent::UACFAIManagerComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
-
-	// ...
+	// Tickets expire on world time, nothing to do per frame
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 
@@ -20,32 +19,33 @@ void UACFAIManagerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ...
-	
+	Holders.Empty();
+	Targets.Empty();
+	ExpiryHeap.Empty();
 }
 
 
-// Called every frame
-void UACFAIManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UACFAIManagerComponent::UpdateTickets(float DeltaTime)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	UpdateTickets(DeltaTime);
+    ExpireTickets(GetWorldTime());
 }
 
-
-void UACFAIManagerComponent::UpdateTickets(float DeltaTime)
+TArray<FACFAITicket> UACFAIManagerComponent::GetActiveTickets() const
 {
-
-    for (FACFAITicket& Ticket : ActiveTickets) {
-        Ticket.TimeRemaining -= DeltaTime;
+    const double currentTime = GetWorldTime();
+    TArray<FACFAITicket> tickets;
+    for (const auto& holder : Holders) {
+        if (holder.Value.bHasTicket && holder.Value.ExpireTime > currentTime) {
+            tickets.Add(FACFAITicket(holder.Value.Target.ResolveObjectPtr(), holder.Key.ResolveObjectPtr(), holder.Value.ExpireTime - currentTime));
+        }
     }
-    ActiveTickets.RemoveAll([](const FACFAITicket& Ticket) { return Ticket.TimeRemaining <= 0.f; });
+    return tickets;
 }
 
 bool UACFAIManagerComponent::HasTicket(AController* AIController) const
 {
-    return ActiveTickets.Contains(AIController);
+    const FTicketHolder* holder = Holders.Find(AIController);
+    return holder && holder->bHasTicket && holder->ExpireTime > GetWorldTime();
 }
 
 bool UACFAIManagerComponent::RequestTicket(AActor* Target, AController* AIController, float Duration)
@@ -53,22 +53,122 @@ bool UACFAIManagerComponent::RequestTicket(AActor* Target, AController* AIContro
     if (!Target || !AIController)
         return false;
 
-    int32 CurrentCount = 0;
-    for (const FACFAITicket& Ticket : ActiveTickets) {
-        if (Ticket.Target == Target && !(Ticket.TimeRemaining <= 0.f)) {
-            ++CurrentCount;
-        }
+    const double currentTime = GetWorldTime();
+    ExpireTickets(currentTime);
+
+    const TObjectKey<AController> controllerKey(AIController);
+    const TObjectKey<AActor> targetKey(Target);
+
+    FTicketHolder& holder = Holders.FindOrAdd(controllerKey);
+    holder.LastRequestTime = currentTime;
+    if (holder.bHasTicket) {
+        // A new request replaces the ticket already held
+        RevokeTicket(holder);
     }
 
-    if (CurrentCount >= MaxAttackersPerTarget) {
+    FTargetTickets& targetTickets = Targets.FindOrAdd(targetKey);
+    PruneWaitingQueue(targetTickets, targetKey, currentTime);
+
+    const int32 freeSlots = MaxAttackersPerTarget - targetTickets.Attackers;
+    const int32 waitingNum = targetTickets.GetWaitingNum();
+    const bool bIsNext = waitingNum > 0 && targetTickets.WaitingQueue[targetTickets.QueueHead] == controllerKey;
+
+    // Waiting controllers are served first, the others only get the slots left over
+    if (freeSlots <= 0 || (!bIsNext && freeSlots <= waitingNum)) {
+        if (holder.QueuedTarget != targetKey) {
+            holder.QueuedTarget = targetKey;
+            targetTickets.WaitingQueue.Add(controllerKey);
+        }
         return false;
     }
 
-    ActiveTickets.Add(FACFAITicket(Target, AIController, Duration));
+    if (bIsNext) {
+        targetTickets.QueueHead++;
+    }
+    holder.QueuedTarget = TObjectKey<AActor>();
+    holder.Target = targetKey;
+    holder.ExpireTime = currentTime + Duration;
+    holder.bHasTicket = true;
+    targetTickets.Attackers++;
+    ExpiryHeap.HeapPush({ holder.ExpireTime, controllerKey });
+
+    OnNewTicketAssigned.Broadcast(AIController);
     return true;
 }
 
 void UACFAIManagerComponent::ReleaseTicket(AController* AIController)
 {
-    ActiveTickets.RemoveAll([&](const FACFAITicket& Ticket) { return Ticket.AIController == AIController; });
+    const TObjectKey<AController> controllerKey(AIController);
+    FTicketHolder* holder = Holders.Find(controllerKey);
+    if (!holder || !holder->bHasTicket) {
+        return;
+    }
+
+    RevokeTicket(*holder);
+    if (holder->QueuedTarget == TObjectKey<AActor>()) {
+        Holders.Remove(controllerKey);
+    }
+}
+
+double UACFAIManagerComponent::GetWorldTime() const
+{
+    const UWorld* world = GetWorld();
+    return world ? world->GetTimeSeconds() : 0.0;
+}
+
+void UACFAIManagerComponent::ExpireTickets(double currentTime)
+{
+    while (ExpiryHeap.Num() > 0 && ExpiryHeap.HeapTop().ExpireTime <= currentTime) {
+        FTicketExpiry expiry;
+        ExpiryHeap.HeapPop(expiry, EAllowShrinking::No);
+
+        FTicketHolder* holder = Holders.Find(expiry.Controller);
+        if (!holder || !holder->bHasTicket || holder->ExpireTime != expiry.ExpireTime) {
+            continue;
+        }
+
+        RevokeTicket(*holder);
+        if (holder->QueuedTarget == TObjectKey<AActor>()) {
+            Holders.Remove(expiry.Controller);
+        }
+    }
+}
+
+void UACFAIManagerComponent::RevokeTicket(FTicketHolder& holder)
+{
+    holder.bHasTicket = false;
+
+    FTargetTickets* targetTickets = Targets.Find(holder.Target);
+    if (!targetTickets) {
+        return;
+    }
+
+    targetTickets->Attackers--;
+    if (targetTickets->Attackers <= 0 && targetTickets->GetWaitingNum() == 0) {
+        Targets.Remove(holder.Target);
+    }
+}
+
+void UACFAIManagerComponent::PruneWaitingQueue(FTargetTickets& targetTickets, const TObjectKey<AActor>& target, double currentTime)
+{
+    // Drop the controllers that stopped asking, got a ticket or moved to another target
+    while (targetTickets.GetWaitingNum() > 0) {
+        const TObjectKey<AController> controllerKey = targetTickets.WaitingQueue[targetTickets.QueueHead];
+        FTicketHolder* holder = Holders.Find(controllerKey);
+        if (holder && holder->QueuedTarget == target) {
+            if (currentTime - holder->LastRequestTime <= WaitingRequestTimeout) {
+                break;
+            }
+            holder->QueuedTarget = TObjectKey<AActor>();
+            if (!holder->bHasTicket) {
+                Holders.Remove(controllerKey);
+            }
+        }
+        targetTickets.QueueHead++;
+    }
+
+    if (targetTickets.QueueHead > 0 && targetTickets.QueueHead * 2 >= targetTickets.WaitingQueue.Num()) {
+        targetTickets.WaitingQueue.RemoveAt(0, targetTickets.QueueHead, EAllowShrinking::No);
+        targetTickets.QueueHead = 0;
+    }
 }
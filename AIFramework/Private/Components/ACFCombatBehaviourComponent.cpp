@@ -81,15 +81,19 @@ bool UACFCombatBehaviourComponent::TryExecuteActionByCombatState(EAICombatState
     return false;
 }
 
-bool UACFCombatBehaviourComponent::EvaluateTicket(const FActionChances& elem)
+UACFAIManagerComponent* UACFCombatBehaviourComponent::GetAIManager()
 {
-    // Verify if we have a ticket or if we can request one
-    TObjectPtr < AGameStateBase> gameState = UGameplayStatics::GetGameState(this);
-    if (!gameState) {
-        return false;
+    if (!cachedAIManager.IsValid()) {
+        const AGameStateBase* gameState = UGameplayStatics::GetGameState(this);
+        cachedAIManager = gameState ? gameState->FindComponentByClass<UACFAIManagerComponent>() : nullptr;
     }
+    return cachedAIManager.Get();
+}
 
-    TObjectPtr<UACFAIManagerComponent> aiManager = gameState->FindComponentByClass<UACFAIManagerComponent>();
+bool UACFCombatBehaviourComponent::EvaluateTicket(const FActionChances& elem)
+{
+    // Verify if we have a ticket or if we can request one
+    UACFAIManagerComponent* aiManager = GetAIManager();
     if (!aiManager) {
         UE_LOG(ACFAILog, Error, TEXT("No AI Manager found! - UACFCombatBehaviourComponent::EvaluateTicket"));
         return false;
@@ -4,6 +4,7 @@
 #include "Actors/ACFActor.h"
 #include "Actors/ACFCharacter.h"
 #include "Interfaces/ACFEntityInterface.h"
+#include <Engine/World.h>
 #include <GameFramework/Actor.h>
 #include <Logging.h>
 
@@ -20,6 +21,7 @@ void UACFThreatManagerComponent::BeginPlay()
 
     DefaultThreatMap.Add(AACFActor::StaticClass(), 5.f);
     DefaultThreatMap.Add(AACFCharacter::StaticClass(), 10.f);
+    InvalidateThreatClassCache();
 }
 
 void UACFThreatManagerComponent::UpdateMaxThreat()
@@ -51,10 +53,11 @@ void UACFThreatManagerComponent::AddThreat(AActor* threatening, float threat)
     }
 
     if (IACFEntityInterface::Execute_IsEntityAlive(threatening)) {
-        if (ThreatMap.Contains(threatening)) {
-            threat += ThreatMap.FindAndRemoveChecked(threatening) * GetThreatMultForActor(threatening);
+        const double currentTime = GetWorldTime();
+        if (const int32* index = ThreatIndices.Find(threatening)) {
+            threat += GetDecayedThreat(ThreatHeap[*index], currentTime) * GetThreatMultForActor(threatening);
         }
-        const float threatMult = ThreatMap.Add(threatening, threat);
+        SetThreat(threatening, threat, currentTime);
         UpdateMaxThreat();
     } else {
         RemoveThreatening(threatening);
@@ -73,13 +76,16 @@ void UACFThreatManagerComponent::RemoveThreat(class AActor* threatening, float t
     }
 
     if (IACFEntityInterface::Execute_IsEntityAlive(threatening)) {
-        if (ThreatMap.Contains(threatening)) {
-            threat -= ThreatMap.FindAndRemoveChecked(threatening);
-
-            if (threat >= 0) {
-                ThreatMap.Add(threatening, threat);
-                UpdateMaxThreat();
+        if (const int32* index = ThreatIndices.Find(threatening)) {
+            const double currentTime = GetWorldTime();
+            const float newThreat = GetDecayedThreat(ThreatHeap[*index], currentTime) - threat;
+
+            if (newThreat >= 0) {
+                SetThreat(threatening, newThreat, currentTime);
+            } else {
+                RemoveHeapEntry(*index);
             }
+            UpdateMaxThreat();
         }
     } else {
         RemoveThreatening(threatening);
@@ -88,26 +94,19 @@ void UACFThreatManagerComponent::RemoveThreat(class AActor* threatening, float t
 
 class AActor* UACFThreatManagerComponent::GetActorWithHigherThreat()
 {
-    float maxThreat = -1.f;
-    AActor* target = nullptr;
-    TArray<AActor*> pendingDelete;
-
-    for (const auto& elem : ThreatMap) {
-        IACFEntityInterface* entity = Cast<IACFEntityInterface>(elem.Key);
-
-        if (!entity || !elem.Key || !IACFEntityInterface::Execute_IsEntityAlive(elem.Key)) {
-            pendingDelete.Add(elem.Key);
-        } else if (elem.Value > maxThreat) {
-            maxThreat = elem.Value;
-            target = elem.Key;
+    // Only the top can be returned, dead or destroyed actors below it are dropped once they get there
+    while (ThreatHeap.Num() > 0) {
+        AActor* top = ThreatHeap[0].Actor;
+        if (IsValid(top) && IACFEntityInterface::Execute_IsEntityAlive(top)) {
+            return top;
         }
-    }
 
-    for (auto* toDelete : pendingDelete) {
-        RemoveThreatening(toDelete);
+        RemoveHeapEntry(0);
+        if (maxThreatening == top) {
+            maxThreatening = nullptr;
+        }
     }
-
-    return target;
+    return nullptr;
 }
 
 bool UACFThreatManagerComponent::IsActorAPotentialThreat(class AActor* threatening) const
@@ -118,25 +117,12 @@ bool UACFThreatManagerComponent::IsActorAPotentialThreat(class AActor* threateni
         return false;
     }
 
-    if (GetThreatMultForActor(threatening) == 0.f) {
-        return false;
-    }
-    if (DefaultThreatMap.Contains(threatening->GetClass())) {
-        return true;
-    }
-
-    for (const auto& elem : DefaultThreatMap) {
-        if (elem.Key && threatening->GetClass()->IsChildOf(elem.Key)) {
-            return true;
-        }
-    }
-
-    return false;
+    return GetThreatClassInfo(threatening->GetClass()).bIsPotentialThreat;
 }
 
 bool UACFThreatManagerComponent::IsThreatening(class AActor* threatening) const
 {
-    return ThreatMap.Contains(threatening);
+    return ThreatIndices.Contains(threatening);
 }
 
 float UACFThreatManagerComponent::GetThreatMultForActor(class AActor* threatening) const
@@ -146,38 +132,24 @@ float UACFThreatManagerComponent::GetThreatMultForActor(class AActor* threatenin
         return -1.f;
     }
 
-    if (ThreatMultipliersByActor.Contains(threatening->GetClass())) {
-        return *ThreatMultipliersByActor.Find(threatening->GetClass());
-    }
-
-    for (const auto& elem : ThreatMultipliersByActor) {
-        if (elem.Key && threatening->GetClass()->IsChildOf(elem.Key)) {
-            return elem.Value;
-        }
-    }
-    return 1.f;
+    return GetThreatClassInfo(threatening->GetClass()).ThreatMult;
 }
 
 float UACFThreatManagerComponent::GetDefaultThreatForActor(AActor* threatening)
 {
-    const float* threat = DefaultThreatMap.Find(threatening->GetClass());
-
-    if (threat && *threat) {
-        return *threat;
-    }
+    return GetThreatClassInfo(threatening->GetClass()).DefaultThreat;
+}
 
-    for (const auto& elem : DefaultThreatMap) {
-        if (elem.Key && threatening->GetClass()->IsChildOf(elem.Key)) {
-            return elem.Value;
-        }
-    }
-    return 0.f;
+float UACFThreatManagerComponent::GetThreat(class AActor* threatening) const
+{
+    const int32* index = ThreatIndices.Find(threatening);
+    return index ? GetDecayedThreat(ThreatHeap[*index], GetWorldTime()) : 0.f;
 }
 
 void UACFThreatManagerComponent::RemoveThreatening(AActor* threatening)
 {
-    if (ThreatMap.Contains(threatening)) {
-        ThreatMap.FindAndRemoveChecked(threatening);
+    if (const int32* index = ThreatIndices.Find(threatening)) {
+        RemoveHeapEntry(*index);
     }
 
     if (maxThreatening == threatening) {
@@ -188,6 +160,142 @@ void UACFThreatManagerComponent::RemoveThreatening(AActor* threatening)
 
 void UACFThreatManagerComponent::RemoveAllThreatenings()
 {
-    ThreatMap.Empty();
+    ThreatHeap.Empty();
+    ThreatIndices.Empty();
+    maxThreatening = nullptr;
     OnNewMaxThreateningActor.Broadcast(nullptr);
 }
+
+const UACFThreatManagerComponent::FThreatClassInfo& UACFThreatManagerComponent::GetThreatClassInfo(const UClass* actorClass) const
+{
+    if (const FThreatClassInfo* cached = ThreatClassCache.Find(actorClass)) {
+        return *cached;
+    }
+
+    FThreatClassInfo info;
+
+    const float* mult = ThreatMultipliersByActor.Find(actorClass);
+    if (mult) {
+        info.ThreatMult = *mult;
+    } else {
+        for (const auto& elem : ThreatMultipliersByActor) {
+            if (elem.Key && actorClass->IsChildOf(elem.Key)) {
+                info.ThreatMult = elem.Value;
+                break;
+            }
+        }
+    }
+
+    const float* threat = DefaultThreatMap.Find(actorClass);
+    info.bIsPotentialThreat = threat != nullptr;
+    if (threat && *threat) {
+        info.DefaultThreat = *threat;
+    } else {
+        for (const auto& elem : DefaultThreatMap) {
+            if (elem.Key && actorClass->IsChildOf(elem.Key)) {
+                info.DefaultThreat = elem.Value;
+                info.bIsPotentialThreat = true;
+                break;
+            }
+        }
+    }
+    info.bIsPotentialThreat &= info.ThreatMult != 0.f;
+
+    return ThreatClassCache.Add(actorClass, info);
+}
+
+double UACFThreatManagerComponent::GetWorldTime() const
+{
+    const UWorld* world = GetWorld();
+    return world ? world->GetTimeSeconds() : 0.0;
+}
+
+float UACFThreatManagerComponent::GetDecayedThreat(const FACFThreatEntry& entry, double currentTime) const
+{
+    if (DecayRate <= 0.f) {
+        return entry.Threat;
+    }
+    return entry.Threat * FMath::Exp(-DecayRate * (currentTime - entry.UpdateTime));
+}
+
+void UACFThreatManagerComponent::SetThreat(AActor* threatening, float threat, double currentTime)
+{
+    int32* index = ThreatIndices.Find(threatening);
+    if (!index) {
+        FACFThreatEntry& entry = ThreatHeap.AddDefaulted_GetRef();
+        entry.Actor = threatening;
+        entry.ActorKey = threatening;
+        index = &ThreatIndices.Add(threatening, ThreatHeap.Num() - 1);
+    }
+
+    const int32 heapIndex = *index;
+    FACFThreatEntry& entry = ThreatHeap[heapIndex];
+    const double oldKey = entry.HeapKey;
+    entry.Threat = threat;
+    entry.UpdateTime = currentTime;
+    // Decay scales every threat by the same factor, comparing the threats at time 0 keeps the order stable
+    entry.HeapKey = FMath::Loge(FMath::Max<double>(threat, UE_SMALL_NUMBER)) + DecayRate * currentTime;
+
+    if (entry.HeapKey > oldKey || heapIndex == ThreatHeap.Num() - 1) {
+        SiftUp(heapIndex);
+    } else {
+        SiftDown(heapIndex);
+    }
+}
+
+void UACFThreatManagerComponent::RemoveHeapEntry(int32 index)
+{
+    const int32 last = ThreatHeap.Num() - 1;
+    if (index != last) {
+        SwapHeapEntries(index, last);
+    }
+
+    ThreatIndices.Remove(ThreatHeap[last].ActorKey);
+    ThreatHeap.RemoveAt(last, 1, EAllowShrinking::No);
+
+    if (index < ThreatHeap.Num()) {
+        SiftUp(index);
+        SiftDown(index);
+    }
+}
+
+void UACFThreatManagerComponent::SiftUp(int32 index)
+{
+    while (index > 0) {
+        const int32 parent = (index - 1) / 2;
+        if (ThreatHeap[parent].HeapKey >= ThreatHeap[index].HeapKey) {
+            break;
+        }
+        SwapHeapEntries(index, parent);
+        index = parent;
+    }
+}
+
+void UACFThreatManagerComponent::SiftDown(int32 index)
+{
+    const int32 num = ThreatHeap.Num();
+    while (true) {
+        const int32 left = 2 * index + 1;
+        const int32 right = left + 1;
+        int32 largest = index;
+
+        if (left < num && ThreatHeap[left].HeapKey > ThreatHeap[largest].HeapKey) {
+            largest = left;
+        }
+        if (right < num && ThreatHeap[right].HeapKey > ThreatHeap[largest].HeapKey) {
+            largest = right;
+        }
+        if (largest == index) {
+            break;
+        }
+        SwapHeapEntries(index, largest);
+        index = largest;
+    }
+}
+
+void UACFThreatManagerComponent::SwapHeapEntries(int32 first, int32 second)
+{
+    ThreatHeap.Swap(first, second);
+    ThreatIndices[ThreatHeap[first].ActorKey] = first;
+    ThreatIndices[ThreatHeap[second].ActorKey] = second;
+}
@@ -6,6 +6,7 @@
 #include "ACFCCTypes.h"
 #include "Actors/ACFCharacter.h"
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
 #include <Engine/DataTable.h>
 #include <GameplayTagContainer.h>
 
@@ -331,6 +332,29 @@ struct FACFAITicket {
     }
 };
 
+/*Entry of the threat heap of UACFThreatManagerComponent*/
+USTRUCT()
+struct FACFThreatEntry {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TObjectPtr<AActor> Actor = nullptr;
+
+    /*Threat at UpdateTime, it decays from there*/
+    UPROPERTY()
+    float Threat = 0.f;
+
+    UPROPERTY()
+    double UpdateTime = 0.0;
+
+    /*Decay invariant ordering key, log(Threat) + DecayRate * UpdateTime*/
+    double HeapKey = 0.0;
+
+    /*Still valid once Actor has been garbage collected*/
+    TObjectKey<AActor> ActorKey;
+};
+
 UCLASS()
 class AIFRAMEWORK_API UACFAITypes : public UObject {
     GENERATED_BODY()
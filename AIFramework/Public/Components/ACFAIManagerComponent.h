@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
 #include "ACFAIManagerComponent.generated.h"
 
 struct FACFAITicket;
@@ -17,6 +18,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewTicketAssigned, AController*,
  * This component manages an AI ticketing system that limits the number of AI controllers
  * allowed to attack a single target simultaneously. It ensures better coordination
  * and prevents AI crowding behavior. Needs to be attached to the Game State
+ *
+ * Tickets expire on world time: their expiry is kept in a priority queue and popped when tickets are
+ * requested, so nothing is updated per tick. Attackers are counted per target, and requesters denied
+ * a ticket queue on their target and are served first come first served once a slot frees up.
  */
 UCLASS(ClassGroup = (ACF), meta = (BlueprintSpawnableComponent))
 class AIFRAMEWORK_API UACFAIManagerComponent : public UActorComponent
@@ -49,10 +54,11 @@ public:
 	 * @return An array of active FACFAITicket instances.
 	 */
 	UFUNCTION(BlueprintPure, Category = "ACF|AI")
-	TArray<FACFAITicket> GetActiveTickets() const { return ActiveTickets; }
+	TArray<FACFAITicket> GetActiveTickets() const;
 
 	/**
-	 * Updates the state of all active tickets (e.g., duration countdown).
+	 * Releases all the expired tickets. Tickets expire on world time, so DeltaTime is unused
+	 * and there is no need to call this every frame.
 	 *
 	 * @param DeltaTime - The time elapsed since the last update.
 	 */
@@ -99,13 +105,49 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|AI")
 	int32 MaxAttackersPerTarget = 1;
 
-	/** The list of currently active tickets issued to AI controllers */
-	UPROPERTY(BlueprintReadOnly, Category = "ACF|AI")
-	TArray<FACFAITicket> ActiveTickets;
+	/** A controller waiting for a ticket loses its turn if it doesn't request it again within this time */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ACF|AI")
+	float WaitingRequestTimeout = 2.f;
+
+private:
+	struct FTicketHolder {
+		TObjectKey<AActor> Target;
+		double ExpireTime = 0.0;
+		bool bHasTicket = false;
 
-public:	
-	// Called every frame
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+		/** Target whose queue this controller is waiting in, if any */
+		TObjectKey<AActor> QueuedTarget;
+		double LastRequestTime = 0.0;
+	};
+
+	struct FTargetTickets {
+		int32 Attackers = 0;
+
+		/** Controllers denied a ticket for this target, oldest first from QueueHead */
+		TArray<TObjectKey<AController>> WaitingQueue;
+		int32 QueueHead = 0;
+
+		int32 GetWaitingNum() const { return WaitingQueue.Num() - QueueHead; }
+	};
+
+	struct FTicketExpiry {
+		double ExpireTime;
+		TObjectKey<AController> Controller;
+
+		bool operator<(const FTicketExpiry& other) const { return ExpireTime < other.ExpireTime; }
+	};
+
+	TMap<TObjectKey<AController>, FTicketHolder> Holders;
+	TMap<TObjectKey<AActor>, FTargetTickets> Targets;
+
+	/** Min heap of the ticket expiries, released and renewed tickets leave stale entries behind */
+	TArray<FTicketExpiry> ExpiryHeap;
+
+	double GetWorldTime() const;
+
+	void ExpireTickets(double currentTime);
+
+	void RevokeTicket(FTicketHolder& holder);
 
-		
+	void PruneWaitingQueue(FTargetTickets& targetTickets, const TObjectKey<AActor>& target, double currentTime);
 };
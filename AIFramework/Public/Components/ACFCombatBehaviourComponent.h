@@ -139,6 +139,11 @@ private:
 
     TObjectPtr<AACFAIController> aiController;
 
+    /*The ticket manager of the game state, resolved the first time a ticket is needed*/
+    TWeakObjectPtr<class UACFAIManagerComponent> cachedAIManager;
+
+    class UACFAIManagerComponent* GetAIManager();
+
     bool EvaluateCombatState(EAICombatState combatState);
 
     /*	void UpdateBehaviorType();*/
@@ -2,14 +2,22 @@
 
 #pragma once
 
+#include "ACFAITypes.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
 
 #include "ACFThreatManagerComponent.generated.h"
 
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewMaxThreateningActor, class AActor*, threatening);
 
+/**
+ * Threat of the actors that engaged the owner. Threats are kept in an indexed max heap, so adding threat
+ * is O(log n) and the most threatening actor is always the top of the heap. Threat decays exponentially
+ * with DecayRate, the decay is applied lazily from the time of the last update and, being the same for
+ * every actor, never changes the heap ordering.
+ */
 UCLASS(ClassGroup = (ACF), Blueprintable, meta = (BlueprintSpawnableComponent))
 class AIFRAMEWORK_API UACFThreatManagerComponent : public UActorComponent {
     GENERATED_BODY()
@@ -46,6 +54,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     float GetDefaultThreatForActor(AActor* threatening);
 
+    /*Returns the current, decayed, threat of the provided actor*/
+    UFUNCTION(BlueprintPure, Category = ACF)
+    float GetThreat(class AActor* threatening) const;
+
     /*Remove the provided actor */
     UFUNCTION(BlueprintCallable, Category = ACF)
     void RemoveThreatening(AActor* threatening);
@@ -53,6 +65,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     void RemoveAllThreatenings();
 
+    /*Default threats and multipliers are cached per class, call this after changing them at runtime*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void InvalidateThreatClassCache() { ThreatClassCache.Empty(); }
+
     /*called when there is a new highest threaning actor in the list*/
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnNewMaxThreateningActor OnNewMaxThreateningActor;
@@ -67,12 +83,42 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACF)
     TMap<TSubclassOf<AActor>, float> ThreatMultipliersByActor;
 
+    /*Exponential decay rate per second: after t seconds threat is multiplied by exp(-DecayRate * t).
+     0.5 keeps about 61% of the threat after one second and halves it every ln(2) / 0.5 = ~1.4 seconds. 0 means threat never decays*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ClampMin = "0.0"), Category = ACF)
+    float DecayRate = 0.f;
+
 private:
+    struct FThreatClassInfo {
+        float DefaultThreat = 0.f;
+        float ThreatMult = 1.f;
+        bool bIsPotentialThreat = false;
+    };
+
+    /*Max heap on FACFThreatEntry::HeapKey*/
     UPROPERTY()
-    TMap<class AActor*, float> ThreatMap;
+    TArray<FACFThreatEntry> ThreatHeap;
+
+    /*Position of each threatening actor in ThreatHeap*/
+    TMap<TObjectKey<AActor>, int32> ThreatIndices;
+
+    mutable TMap<TObjectKey<UClass>, FThreatClassInfo> ThreatClassCache;
 
     UPROPERTY()
     class AActor* maxThreatening;
 
     void UpdateMaxThreat();
+
+    const FThreatClassInfo& GetThreatClassInfo(const UClass* actorClass) const;
+
+    double GetWorldTime() const;
+
+    float GetDecayedThreat(const FACFThreatEntry& entry, double currentTime) const;
+
+    void SetThreat(AActor* threatening, float threat, double currentTime);
+
+    void RemoveHeapEntry(int32 index);
+    void SiftUp(int32 index);
+    void SiftDown(int32 index);
+    void SwapHeapEntries(int32 first, int32 second);
 };
@@ -0,0 +1,66 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFCooldownTimeline.h"
+
+void FACFCooldownTimeline::Start(const FGameplayTag& tag, float endTime)
+{
+    int32* slot = Slots.Find(tag);
+    if (!slot) {
+        slot = &Slots.Add(tag, EndTimes.Add(endTime));
+        ActiveSlots.Add(false);
+    }
+
+    EndTimes[*slot] = endTime;
+    ActiveSlots[*slot] = true;
+    Heap.HeapPush({ endTime, *slot });
+}
+
+void FACFCooldownTimeline::Stop(const FGameplayTag& tag)
+{
+    if (const int32* slot = FindActiveSlot(tag)) {
+        // The heap entry becomes stale and is dropped on the next expiry
+        ActiveSlots[*slot] = false;
+    }
+}
+
+bool FACFCooldownTimeline::IsOnCooldown(const FGameplayTag& tag, float currentTime) const
+{
+    const int32* slot = FindActiveSlot(tag);
+    return slot && EndTimes[*slot] > currentTime;
+}
+
+float FACFCooldownTimeline::GetTimeRemaining(const FGameplayTag& tag, float currentTime) const
+{
+    const int32* slot = FindActiveSlot(tag);
+    return slot ? FMath::Max(EndTimes[*slot] - currentTime, 0.f) : 0.f;
+}
+
+int32 FACFCooldownTimeline::ExpireUntil(float currentTime)
+{
+    int32 expired = 0;
+    while (Heap.Num() > 0 && Heap.HeapTop().EndTime <= currentTime) {
+        FCooldownEntry entry;
+        Heap.HeapPop(entry, EAllowShrinking::No);
+
+        // Restarted or stopped cooldowns left this entry behind
+        if (ActiveSlots[entry.Slot] && EndTimes[entry.Slot] == entry.EndTime) {
+            ActiveSlots[entry.Slot] = false;
+            expired++;
+        }
+    }
+    return expired;
+}
+
+void FACFCooldownTimeline::Reset()
+{
+    Slots.Empty();
+    EndTimes.Empty();
+    ActiveSlots.Empty();
+    Heap.Empty();
+}
+
+const int32* FACFCooldownTimeline::FindActiveSlot(const FGameplayTag& tag) const
+{
+    const int32* slot = Slots.Find(tag);
+    return slot && ActiveSlots[*slot] ? slot : nullptr;
+}
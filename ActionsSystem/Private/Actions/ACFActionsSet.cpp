@@ -10,7 +10,7 @@
 
 bool UACFActionsSet::GetActionByTag(const FGameplayTag& Action, FActionState& outAction) const
 {
-	const FActionState* actionState = Actions.FindByKey(Action);
+	const FActionState* actionState = FindAction(Action);
 	if (actionState) {
 		outAction = *actionState;
 		return true;
@@ -18,12 +18,38 @@ bool UACFActionsSet::GetActionByTag(const FGameplayTag& Action, FActionState& ou
 	return false;
 }
 
+const FActionState* UACFActionsSet::FindAction(const FGameplayTag& action) const
+{
+	if (!bActionIndicesBuilt) {
+		ActionIndices.Reset();
+		for (int32 index = 0; index < Actions.Num(); ++index) {
+			// First one wins, like FindByKey
+			if (!ActionIndices.Contains(Actions[index].TagName)) {
+				ActionIndices.Add(Actions[index].TagName, index);
+			}
+		}
+		bActionIndicesBuilt = true;
+	}
+
+	const int32* index = ActionIndices.Find(action);
+	return index ? &Actions[*index] : nullptr;
+}
+
 void UACFActionsSet::AddOrModifyAction(const FActionState& action)
 {
 	if (Actions.Contains(action.TagName)) {
 		Actions.Remove(action);
 	}
 	Actions.AddUnique(action);
+	bActionIndicesBuilt = false;
+}
+
+#if WITH_EDITOR
+void UACFActionsSet::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bActionIndicesBuilt = false;
 }
+#endif
 
 
@@ -319,13 +319,7 @@ UACFBaseAction::UACFBaseAction()
 
 float UACFBaseAction::GetCooldownTimeRemaining()
 {
-    UWorld* world = GetWorld();
-    if (world) {
-        return world->GetTimerManager().GetTimerRemaining(CooldownTimerReference);
-
-    } else {
-        return 0.0f;
-    }
+    return ActionsManager ? ActionsManager->GetCooldownTimeRemaining(ActionTag) : 0.f;
 }
 
 void UACFBaseAction::StartCooldown()
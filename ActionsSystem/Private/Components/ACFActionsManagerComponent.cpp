@@ -39,8 +39,10 @@ UACFActionsManagerComponent::UACFActionsManagerComponent()
 void UACFActionsManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
+    // Definitions are shared by every character, actions are instanced on demand in ActionsRuntimeState
+    ActionsRuntimeState = FACFActionsRuntimeState();
     if (ActionsSet) {
-        ActionsSetInst = NewObject<UACFActionsSet>(this, ActionsSet);
+        ActionsSetInst = ActionsSet->GetDefaultObject<UACFActionsSet>();
     } else {
         UE_LOG(LogTemp, Error, TEXT("Invalid ActionSet Class- ActionsManager"));
     }
@@ -48,8 +50,7 @@ void UACFActionsManagerComponent::BeginPlay()
     MovesetsActionsInst.Empty();
     for (const auto& actionssetclass : MovesetActions) {
         if (actionssetclass.ActionsSet) {
-            UACFActionsSet* moveset = NewObject<UACFActionsSet>(this, actionssetclass.ActionsSet);
-            MovesetsActionsInst.Add(actionssetclass.TagName, moveset);
+            MovesetsActionsInst.Add(actionssetclass.TagName, actionssetclass.ActionsSet->GetDefaultObject<UACFActionsSet>());
         } else {
             UE_LOG(LogTemp, Error, TEXT("Invalid ActionSet Class- ActionsManager"));
         }
@@ -83,9 +84,10 @@ void UACFActionsManagerComponent::StopActionImmeditaley_Implementation()
 
 void UACFActionsManagerComponent::Internal_StopCurrentAnimation()
 {
-    FActionState action;
-    if (GetActionByTag(CurrentActionTag, action)) {
-        animInst->Montage_Stop(0.0f, action.MontageAction);
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(CurrentActionTag, action, actionInstance)) {
+        animInst->Montage_Stop(0.0f, action->MontageAction);
     }
 }
 
@@ -136,8 +138,9 @@ void UACFActionsManagerComponent::TriggerAction_Implementation(FGameplayTag Acti
 
     OnActionTriggered.Broadcast(ActionState, Priority);
 
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action && CanExecuteAction(ActionState)) {
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(ActionState, action, actionInstance) && actionInstance && CanExecuteAction(ActionState)) {
         if ((((int32)Priority > CurrentPriority)) || Priority == EActionPriority::EHighest) {
             LaunchAction(ActionState, Priority, contextString);
         } else if (CurrentActionTag != FGameplayTag() && bCanStoreAction && bCanBeStored) {
@@ -164,7 +167,52 @@ void UACFActionsManagerComponent::ClientPlayMontage_Implementation(const FACFMon
 bool UACFActionsManagerComponent::IsActionOnCooldown(
     FGameplayTag action) const
 {
-    return onCooldownActions.Contains(action);
+    const float currentTime = GetWorldTime();
+    if (ActionsRuntimeState.ActionCooldowns.IsOnCooldown(action, currentTime)) {
+        return true;
+    }
+
+    const FActionConfig* config = FindActionConfig(action);
+    if (!config) {
+        return false;
+    }
+    if (config->bUseGlobalCooldown && ActionsRuntimeState.GlobalCooldownEndTime > currentTime) {
+        return true;
+    }
+    return config->CooldownCategory.IsValid() && ActionsRuntimeState.CategoryCooldowns.IsOnCooldown(config->CooldownCategory, currentTime);
+}
+
+float UACFActionsManagerComponent::GetCooldownTimeRemaining(FGameplayTag action) const
+{
+    const float currentTime = GetWorldTime();
+    float remaining = ActionsRuntimeState.ActionCooldowns.GetTimeRemaining(action, currentTime);
+
+    if (const FActionConfig* config = FindActionConfig(action)) {
+        if (config->bUseGlobalCooldown) {
+            remaining = FMath::Max(remaining, ActionsRuntimeState.GlobalCooldownEndTime - currentTime);
+        }
+        if (config->CooldownCategory.IsValid()) {
+            remaining = FMath::Max(remaining, ActionsRuntimeState.CategoryCooldowns.GetTimeRemaining(config->CooldownCategory, currentTime));
+        }
+    }
+    return remaining;
+}
+
+void UACFActionsManagerComponent::StartGlobalCooldown(float duration)
+{
+    if (duration > 0.f) {
+        ActionsRuntimeState.GlobalCooldownEndTime = FMath::Max(ActionsRuntimeState.GlobalCooldownEndTime, GetWorldTime() + duration);
+    }
+}
+
+void UACFActionsManagerComponent::StartCategoryCooldown(FGameplayTag category, float duration)
+{
+    if (!category.IsValid() || duration <= 0.f) {
+        return;
+    }
+    const float currentTime = GetWorldTime();
+    ActionsRuntimeState.CategoryCooldowns.ExpireUntil(currentTime);
+    ActionsRuntimeState.CategoryCooldowns.Start(category, currentTime + duration);
 }
 
 void UACFActionsManagerComponent::StoreAction(FGameplayTag ActionState, const FString& contextString)
@@ -176,18 +224,19 @@ void UACFActionsManagerComponent::StoreAction(FGameplayTag ActionState, const FS
 void UACFActionsManagerComponent::LaunchAction(const FGameplayTag& ActionState,
     const EActionPriority priority, const FString& contextString)
 {
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action) {
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(ActionState, action, actionInstance) && actionInstance) {
         if (PerformingAction) {
-            action.Action->OnActionTransition(PerformingAction);
+            actionInstance->OnActionTransition(PerformingAction);
             TerminateCurrentAction();
         }
-        PerformingAction = action.Action;
+        PerformingAction = actionInstance;
         CurrentActionTag = ActionState;
         bIsPerformingAction = true;
         PerformingAction->SetTerminated(false);
         CurrentPriority = (int32)priority;
-        PerformingAction->Internal_OnActivated(this, action.MontageAction, contextString);
+        PerformingAction->Internal_OnActivated(this, action->MontageAction, contextString);
         ClientsReceiveActionStarted(ActionState, contextString);
        
         if (PerformingAction && PerformingAction->ActionConfig.bPlayEffectOnActionStart) {
@@ -219,10 +268,11 @@ void UACFActionsManagerComponent::ClientsReceiveActionEnded_Implementation(
     const FGameplayTag& ActionState)
 {
     PrintStateDebugInfo(false);
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action) {
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(ActionState, action, actionInstance) && actionInstance) {
 
-        action.Action->ClientsOnActionEnded();
+        actionInstance->ClientsOnActionEnded();
     }
     OnActionFinished.Broadcast(ActionState);
 }
@@ -239,31 +289,34 @@ void UACFActionsManagerComponent::ClientsReceiveActionStarted_Implementation(
     OnActionStarted.Broadcast(ActionState);
     PrintStateDebugInfo(true);
 
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action) {
-        PerformingAction = action.Action;
-        if (action.Action->GetActionConfig().bAutoStartCooldown) {
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(ActionState, action, actionInstance) && actionInstance) {
+        PerformingAction = actionInstance;
+        if (actionInstance->GetActionConfig().bAutoStartCooldown) {
             StartCooldown(ActionState, PerformingAction);
         }
-        action.Action->CharacterOwner = CharacterOwner;
-        action.Action->ClientsOnActionStarted(contextString);
+        actionInstance->CharacterOwner = CharacterOwner;
+        actionInstance->ClientsOnActionStarted(contextString);
     }
 }
 
-bool UACFActionsManagerComponent::CanExecuteAction(FGameplayTag ActionState) const
+bool UACFActionsManagerComponent::CanExecuteAction(FGameplayTag ActionState)
 {
-    FActionState action;
-    if (GetActionByTag(ActionState, action) && action.Action && StatisticComp) {
+    // CanExecuteAction of the action is evaluated on the instance of this character, never on the shared one
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(ActionState, action, actionInstance) && actionInstance && StatisticComp) {
         UCharacterMovementComponent* moveComp = CharacterOwner->GetCharacterMovement();
-        if (moveComp && !action.Action->ActionConfig.PerformableInMovementModes.Contains(moveComp->MovementMode)) {
+        if (moveComp && !actionInstance->ActionConfig.PerformableInMovementModes.Contains(moveComp->MovementMode)) {
             UE_LOG(LogTemp, Warning, TEXT("Actions Can't be exectuted while in air!"));
             return false;
         }
 
-        if (StatisticComp->CheckCosts(action.Action->ActionConfig.ActionCost) && 
-            StatisticComp->CheckPrimaryAttributesRequirements(action.Action->ActionConfig.Requirements) && 
-            !IsActionOnCooldown(ActionState) && !bIsLocked && action.Action->CanExecuteAction(CharacterOwner) && 
-            StatisticComp->GetCurrentLevel() >= action.Action->ActionConfig.RequiredLevel) {
+        if (StatisticComp->CheckCosts(actionInstance->ActionConfig.ActionCost) && 
+            StatisticComp->CheckPrimaryAttributesRequirements(actionInstance->ActionConfig.Requirements) && 
+            !IsActionOnCooldown(ActionState) && !bIsLocked && actionInstance->CanExecuteAction(CharacterOwner) && 
+            StatisticComp->GetCurrentLevel() >= actionInstance->ActionConfig.RequiredLevel) {
             return true;
         } else {
             UE_LOG(LogTemp, Warning, TEXT("Actions Costs OR Actions Attribute Requirements are not verified"));
@@ -326,30 +379,110 @@ void UACFActionsManagerComponent::FreeAction()
     }
 }
 
-bool UACFActionsManagerComponent::GetMovesetActionByTag(const FGameplayTag& action, const FGameplayTag& Moveset, FActionState& outAction) const
+bool UACFActionsManagerComponent::GetMovesetActionByTag(const FGameplayTag& action, const FGameplayTag& Moveset, FActionState& outAction)
 {
-    if (MovesetsActionsInst.Contains(Moveset)) {
-        UACFActionsSet* actionSet = MovesetsActionsInst.FindChecked(Moveset);
-        if (actionSet) {
-            return actionSet->GetActionByTag(action, outAction);
-        }
+    const TObjectPtr<UACFActionsSet>* actionSet = MovesetsActionsInst.Find(Moveset);
+    if (actionSet && *actionSet) {
+        return MakeCharacterActionState((*actionSet)->FindAction(action), outAction);
     }
     return false;
 }
 
-bool UACFActionsManagerComponent::GetCommonActionByTag(const FGameplayTag& action, FActionState& outAction) const
+bool UACFActionsManagerComponent::GetCommonActionByTag(const FGameplayTag& action, FActionState& outAction)
 {
+    if (const FActionState* overridden = ActionsRuntimeState.OverriddenActions.Find(action)) {
+        outAction = *overridden;
+        return true;
+    }
     if (ActionsSetInst) {
-        return ActionsSetInst->GetActionByTag(action, outAction);
+        return MakeCharacterActionState(ActionsSetInst->FindAction(action), outAction);
     }
     return false;
 }
 
 void UACFActionsManagerComponent::AddOrModifyAction(const FActionState& action)
 {
-    if (ActionsSetInst) {
-        return ActionsSetInst->AddOrModifyAction(action);
+    // The definition is shared, changes only apply to this character
+    ActionsRuntimeState.OverriddenActions.Add(action.TagName, action);
+}
+
+bool UACFActionsManagerComponent::FindAction(const FGameplayTag& action, const FActionState*& outState, UACFBaseAction*& outAction)
+{
+    outState = FindActionDefinition(action);
+    outAction = nullptr;
+    if (!outState) {
+        return false;
     }
+
+    // Overridden actions are already owned by this character
+    if (outState == ActionsRuntimeState.OverriddenActions.Find(action)) {
+        outAction = outState->Action;
+    } else {
+        outAction = GetOrCreateActionInstance(outState->Action);
+    }
+    return true;
+}
+
+const FActionState* UACFActionsManagerComponent::FindActionDefinition(const FGameplayTag& action) const
+{
+    if (!ActionsSetInst) {
+        return nullptr;
+    }
+
+    const TObjectPtr<UACFActionsSet>* moveset = MovesetsActionsInst.Find(currentMovesetActionsTag);
+    if (moveset && *moveset) {
+        if (const FActionState* state = (*moveset)->FindAction(action)) {
+            return state;
+        }
+    }
+
+    if (const FActionState* overridden = ActionsRuntimeState.OverriddenActions.Find(action)) {
+        return overridden;
+    }
+    return ActionsSetInst->FindAction(action);
+}
+
+const FActionConfig* UACFActionsManagerComponent::FindActionConfig(const FGameplayTag& action) const
+{
+    const FActionState* state = FindActionDefinition(action);
+    if (!state || !state->Action) {
+        return nullptr;
+    }
+
+    // Configs can be changed at runtime on the instance, don't create one just to read it
+    const TObjectPtr<UACFBaseAction>* instance = ActionsRuntimeState.InstancedActions.Find(state->Action);
+    const UACFBaseAction* actionRef = instance && *instance ? instance->Get() : state->Action.Get();
+    return &actionRef->ActionConfig;
+}
+
+float UACFActionsManagerComponent::GetWorldTime() const
+{
+    const UWorld* world = GetWorld();
+    return world ? world->GetTimeSeconds() : 0.f;
+}
+
+UACFBaseAction* UACFActionsManagerComponent::GetOrCreateActionInstance(UACFBaseAction* templateAction)
+{
+    if (!templateAction) {
+        return nullptr;
+    }
+
+    TObjectPtr<UACFBaseAction>& instance = ActionsRuntimeState.InstancedActions.FindOrAdd(templateAction);
+    if (!instance) {
+        instance = DuplicateObject<UACFBaseAction>(templateAction, this);
+        instance->CharacterOwner = CharacterOwner;
+    }
+    return instance;
+}
+
+bool UACFActionsManagerComponent::MakeCharacterActionState(const FActionState* state, FActionState& outAction)
+{
+    if (!state) {
+        return false;
+    }
+    outAction = *state;
+    outAction.Action = GetOrCreateActionInstance(state->Action);
+    return true;
 }
 
 void UACFActionsManagerComponent::SetCurrentPriority(EActionPriority newPriority)
@@ -362,16 +495,14 @@ FGameplayTag UACFActionsManagerComponent::GetCurrentActionTag() const
     return CurrentActionTag;
 }
 
-bool UACFActionsManagerComponent::GetActionByTag(const FGameplayTag& Action, FActionState& outAction) const
+bool UACFActionsManagerComponent::GetActionByTag(const FGameplayTag& Action, FActionState& outAction)
 {
-    if (ActionsSetInst) {
-        if (GetMovesetActionByTag(Action, currentMovesetActionsTag, outAction)) {
-            return true;
-        } else if (GetCommonActionByTag(Action, outAction)) {
-            return true;
-        }
-    } else {
-        return false;
+    const FActionState* action = nullptr;
+    UACFBaseAction* actionInstance = nullptr;
+    if (FindAction(Action, action, actionInstance)) {
+        outAction = *action;
+        outAction.Action = actionInstance;
+        return true;
     }
     return false;
 }
@@ -494,29 +625,23 @@ void UACFActionsManagerComponent::PrepareWarp()
 
 void UACFActionsManagerComponent::StartCooldown(const FGameplayTag& action, UACFBaseAction* actionRef)
 {
-    if (actionRef->GetActionConfig().CoolDownTime == 0.f) {
+    if (!actionRef) {
         return;
     }
 
-    FTimerDelegate TimerDel;
-    TimerDel.BindUFunction(this, FName("OnCooldownFinished"), action);
-
-    UWorld* world = GetWorld();
-    if (world) {
-        world->GetTimerManager().SetTimer(
-            actionRef->CooldownTimerReference, TimerDel, actionRef->GetActionConfig().CoolDownTime,
-            false);
-        onCooldownActions.Add(action);
+    const FActionConfig& config = actionRef->ActionConfig;
+    if (config.bUseGlobalCooldown) {
+        StartGlobalCooldown(GlobalCoolDownTime);
     }
-    UE_LOG(LogTemp, Warning, TEXT("Starting cooldown for action %s and timer %f"), *action.ToString(), actionRef->GetActionConfig().CoolDownTime);
-}
-
+    StartCategoryCooldown(config.CooldownCategory, config.CategoryCoolDownTime);
 
-
-void UACFActionsManagerComponent::OnCooldownFinished(
-    const FGameplayTag& action)
-{
-    if (onCooldownActions.Contains(action)) {
-        onCooldownActions.Remove(action);
+    if (config.CoolDownTime <= 0.f) {
+        return;
     }
+
+    // Elapsed cooldowns are cleared in batch here instead of by one timer each
+    const float currentTime = GetWorldTime();
+    ActionsRuntimeState.ActionCooldowns.ExpireUntil(currentTime);
+    ActionsRuntimeState.ActionCooldowns.Start(action, currentTime + config.CoolDownTime);
+    UE_LOG(LogTemp, Warning, TEXT("Starting cooldown for action %s and timer %f"), *action.ToString(), config.CoolDownTime);
 }
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ACFCooldownTimeline.h"
 #include "ACMTypes.h"
 #include "ARSTypes.h"
 #include "Camera/CameraShakeBase.h"
@@ -185,6 +186,30 @@ public:
     TObjectPtr<class UACFBaseAction> Action;
 };
 
+/*Per character state of the actions sets, the sets themselves are shared definitions*/
+USTRUCT()
+struct FACFActionsRuntimeState {
+    GENERATED_BODY()
+
+public:
+    /*Per character copies of the definition actions, by template, created the first time each action is used*/
+    UPROPERTY()
+    TMap<TObjectPtr<UACFBaseAction>, TObjectPtr<UACFBaseAction>> InstancedActions;
+
+    /*Common actions added or modified at runtime, they hide the ones of the definition*/
+    UPROPERTY()
+    TMap<FGameplayTag, FActionState> OverriddenActions;
+
+    /*Running cooldowns of the single actions, by action tag*/
+    FACFCooldownTimeline ActionCooldowns;
+
+    /*Running cooldowns shared by every action of a category, by CooldownCategory*/
+    FACFCooldownTimeline CategoryCooldowns;
+
+    /*World time at which the global cooldown ends*/
+    float GlobalCooldownEndTime = 0.f;
+};
+
 USTRUCT(BlueprintType)
 struct FActionsSet : public FACFStruct {
 
@@ -292,6 +317,18 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACFActionConfig)
     float CoolDownTime;
+
+    /*Whether this action waits for and starts the global cooldown of its ActionsManager*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACFActionConfig)
+    bool bUseGlobalCooldown = false;
+
+    /*Actions sharing the same category can't be performed while the category is on cooldown*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACFActionConfig)
+    FGameplayTag CooldownCategory;
+
+    /*Cooldown started on CooldownCategory together with the one of the action, 0 means none*/
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = ACFActionConfig)
+    float CategoryCoolDownTime = 0.f;
 };
 
 UCLASS()
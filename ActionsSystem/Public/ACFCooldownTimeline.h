@@ -0,0 +1,51 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/BitArray.h"
+#include "CoreMinimal.h"
+#include <GameplayTagContainer.h>
+
+/**
+ * Cooldowns of a character keyed by gameplay tag, all expressed as world times.
+ * Every tag gets a stable slot the first time it is used, so queries are a map lookup plus a bit test.
+ * End times are also pushed in a min heap, ExpireUntil clears every elapsed cooldown in a single pass
+ * without any per cooldown timer. Restarting a cooldown leaves its old heap entry behind, stale entries
+ * are recognized by their end time and dropped when they reach the top.
+ */
+struct ACTIONSSYSTEM_API FACFCooldownTimeline {
+
+public:
+    /*Starts or restarts the cooldown of tag, it will elapse at endTime*/
+    void Start(const FGameplayTag& tag, float endTime);
+
+    /*Ends the cooldown of tag right away*/
+    void Stop(const FGameplayTag& tag);
+
+    bool IsOnCooldown(const FGameplayTag& tag, float currentTime) const;
+
+    float GetTimeRemaining(const FGameplayTag& tag, float currentTime) const;
+
+    /*Clears all the cooldowns elapsed at currentTime, returns how many were cleared*/
+    int32 ExpireUntil(float currentTime);
+
+    /*End time of the first cooldown to elapse, or a negative value if none is running*/
+    float GetNextEndTime() const { return Heap.Num() > 0 ? Heap.HeapTop().EndTime : -1.f; }
+
+    void Reset();
+
+private:
+    struct FCooldownEntry {
+        float EndTime;
+        int32 Slot;
+
+        bool operator<(const FCooldownEntry& other) const { return EndTime < other.EndTime; }
+    };
+
+    const int32* FindActiveSlot(const FGameplayTag& tag) const;
+
+    TMap<FGameplayTag, int32> Slots;
+    TArray<float> EndTimes;
+    TBitArray<> ActiveSlots;
+    TArray<FCooldownEntry> Heap;
+};
@@ -25,7 +25,20 @@ public:
 
 	bool GetActionByTag(const FGameplayTag& action, FActionState& outAction) const;
 
+	/*Tag indexed, the returned action is the shared template of the definition*/
+	const FActionState* FindAction(const FGameplayTag& action) const;
+
 	void GetActions(TArray<FActionState>& outActions) const {
 		outActions = Actions;
 	}
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/*Built on first lookup, the class default object of each set is shared by all the characters using it*/
+	mutable TMap<FGameplayTag, int32> ActionIndices;
+
+	mutable bool bActionIndicesBuilt = false;
 };
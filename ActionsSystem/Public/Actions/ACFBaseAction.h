@@ -203,9 +203,6 @@ protected:
 
     UWorld* GetWorld() const override { return CharacterOwner ? CharacterOwner->GetWorld() : nullptr; }
 
-    /*A reference to the cooldown started for the Action*/
-    UPROPERTY(BlueprintReadOnly, Category = ACF)
-    FTimerHandle CooldownTimerReference;
     void BindAnimationEvents();
 
     TObjectPtr<class UARSStatisticsComponent> StatisticComp;
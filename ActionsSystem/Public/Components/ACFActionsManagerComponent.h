@@ -49,12 +49,23 @@ protected:
     UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, meta = (TitleProperty = "TagName"), Category = ACF)
     TArray<FActionsSet> MovesetActions;
 
-    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    /*Cooldown shared by all the actions with bUseGlobalCooldown, started whenever one of them starts its cooldown*/
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = ACF)
+    float GlobalCoolDownTime = 0.f;
+
+    /*Shared definition of ActionsSet (its class default object), never modified at runtime.
+     * Not exposed to Blueprint, use GetActionByTag / GetCommonActionByTag instead*/
+    UPROPERTY()
     TObjectPtr<UACFActionsSet> ActionsSetInst = nullptr;
 
-    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    /*Shared definitions of the MovesetActions, never modified at runtime*/
+    UPROPERTY()
     TMap<FGameplayTag, TObjectPtr<UACFActionsSet>> MovesetsActionsInst;
 
+    /*Instanced actions and runtime modifications of this character*/
+    UPROPERTY()
+    FACFActionsRuntimeState ActionsRuntimeState;
+
 public:
     // Called every frame
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -102,9 +113,21 @@ public:
         bCanStoreAction = true;
     }
 
+    /*True if the action, its cooldown category or, if it uses it, the global cooldown are running*/
     UFUNCTION(BlueprintCallable, Category = ACF)
     bool IsActionOnCooldown(FGameplayTag action) const;
 
+    UFUNCTION(BlueprintPure, Category = ACF)
+    float GetCooldownTimeRemaining(FGameplayTag action) const;
+
+    /*Starts the global cooldown, call this also clientside for UI*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void StartGlobalCooldown(float duration);
+
+    /*Starts the cooldown of all the actions with the provided CooldownCategory, call this also clientside for UI*/
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void StartCategoryCooldown(FGameplayTag category, float duration);
+
     UFUNCTION(BlueprintCallable, Category = ACF)
     void StoreAction(FGameplayTag Action, const FString& contextString = "");
 
@@ -112,7 +135,7 @@ public:
     FORCEINLINE FGameplayTag GetStoredAction() const { return StoredAction; }
 
     UFUNCTION(BlueprintCallable, Category = ACF)
-    bool CanExecuteAction(FGameplayTag Action) const;
+    bool CanExecuteAction(FGameplayTag Action);
 
     /*Terminates current action*/
     UFUNCTION(BlueprintCallable, Category = ACF)
@@ -150,8 +173,9 @@ public:
     UFUNCTION(BlueprintCallable, Server, Reliable, Category = ACF)
     void StopActionImmeditaley();
 
+    /*Action is the instance of this character, created if the action was never used*/
     UFUNCTION(BlueprintCallable, Category = ACF)
-    bool GetActionByTag(const FGameplayTag& Action, FActionState& outAction) const;
+    bool GetActionByTag(const FGameplayTag& Action, FActionState& outAction);
 
     UFUNCTION(BlueprintCallable, Category = ACF)
     void PlayCurrentActionFX();
@@ -173,10 +197,10 @@ public:
     void FreeAction();
 
     UFUNCTION(BlueprintCallable, Category = ACF)
-    bool GetMovesetActionByTag(const FGameplayTag& action, const FGameplayTag& Moveset, FActionState& outAction) const;
+    bool GetMovesetActionByTag(const FGameplayTag& action, const FGameplayTag& Moveset, FActionState& outAction);
 
     UFUNCTION(BlueprintCallable, Category = ACF)
-    bool GetCommonActionByTag(const FGameplayTag& action, FActionState& outAction) const;
+    bool GetCommonActionByTag(const FGameplayTag& action, FActionState& outAction);
 
     UFUNCTION(BlueprintCallable, Category = ACF)
     void AddOrModifyAction(const FActionState& action);
@@ -199,6 +223,21 @@ private:
 
     void TerminateCurrentAction();
 
+    /*Finds the definition of the action in the current moveset or in the common actions and the instance of this character*/
+    bool FindAction(const FGameplayTag& action, const FActionState*& outState, UACFBaseAction*& outAction);
+
+    /*Same lookup as FindAction without instancing the action*/
+    const FActionState* FindActionDefinition(const FGameplayTag& action) const;
+
+    /*The config of the character's instance of the action if any, otherwise the one of the definition*/
+    const FActionConfig* FindActionConfig(const FGameplayTag& action) const;
+
+    float GetWorldTime() const;
+
+    UACFBaseAction* GetOrCreateActionInstance(UACFBaseAction* templateAction);
+
+    bool MakeCharacterActionState(const FActionState* state, FActionState& outAction);
+
     UPROPERTY()
     class UAnimInstance* animInst;
 
@@ -244,16 +283,9 @@ private:
 
     void PrepareWarp();
 
-    UPROPERTY()
-    TArray<FGameplayTag> onCooldownActions;
-
     UPROPERTY()
     FACFMontageInfo MontageInfo;
 
-
-    UFUNCTION()
-    void OnCooldownFinished(const FGameplayTag& action);
-
     void Internal_StopCurrentAnimation();
 
     bool bIsLocked = false;
@@ -28,7 +28,8 @@ public class AdvancedRPGSystem : ModuleRules
 				"Core",
               "OnlineSubsystem",
               "OnlineSubsystemUtils",
-			  "DeveloperSettings"
+			  "DeveloperSettings",
+			  "NetCore"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -0,0 +1,235 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ARSRegenerationSubsystem.h"
+#include "ARSDeveloperSettings.h"
+#include "ARSStatisticsComponent.h"
+#include <Engine/World.h>
+#include <TimerManager.h>
+
+void UARSRegenerationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    const UARSDeveloperSettings* settings = GetDefault<UARSDeveloperSettings>();
+    LastUpdateTime = InWorld.GetTimeSeconds();
+    InWorld.GetTimerManager().SetTimer(UpdateTimer, this, &UARSRegenerationSubsystem::UpdateRegeneration, settings->RegenerationInterval, true);
+}
+
+void UARSRegenerationSubsystem::Deinitialize()
+{
+    if (UWorld* world = GetWorld()) {
+        world->GetTimerManager().ClearTimer(UpdateTimer);
+    }
+
+    ComponentRows.Empty();
+    FreeRows.Empty();
+    Components.Empty();
+    StatTypes.Empty();
+    Values.Empty();
+    MinValues.Empty();
+    MaxValues.Empty();
+    RegenRates.Empty();
+    RegenDelays.Empty();
+    ResumeTimes.Empty();
+    RowStates.Empty();
+    ActiveRows.Empty();
+    DelayedRows.Empty();
+    RegeneratedValues.Empty();
+
+    Super::Deinitialize();
+}
+
+void UARSRegenerationSubsystem::RegisterComponent(UARSStatisticsComponent* component, const TArray<FStatistic>& statistics)
+{
+    if (!component) {
+        return;
+    }
+
+    TArray<int32>& rows = ComponentRows.FindOrAdd(component);
+
+    // Drop the rows of statistics that are gone or stopped regenerating
+    for (int32 index = rows.Num() - 1; index >= 0; --index) {
+        const FStatistic* statistic = statistics.FindByKey(StatTypes[rows[index]]);
+        if (!statistic || !statistic->HasRegeneration) {
+            FreeRow(rows[index]);
+            rows.RemoveAtSwap(index);
+        }
+    }
+
+    for (const FStatistic& statistic : statistics) {
+        if (!statistic.HasRegeneration) {
+            continue;
+        }
+        int32 row = FindRow(component, statistic.StatType);
+        if (row == INDEX_NONE) {
+            row = AllocateRow();
+            rows.Add(row);
+            Components[row] = component;
+            StatTypes[row] = statistic.StatType;
+            ResumeTimes[row] = 0.f;
+        }
+        WriteRow(row, statistic);
+        WakeRow(row);
+    }
+
+    if (rows.Num() == 0) {
+        ComponentRows.Remove(component);
+    }
+}
+
+void UARSRegenerationSubsystem::UnregisterComponent(UARSStatisticsComponent* component)
+{
+    TArray<int32> rows;
+    if (ComponentRows.RemoveAndCopyValue(component, rows)) {
+        for (const int32 row : rows) {
+            FreeRow(row);
+        }
+    }
+}
+
+void UARSRegenerationSubsystem::NotifyStatModified(UARSStatisticsComponent* component, const FStatistic& statistic, bool bResetDelay)
+{
+    const int32 row = FindRow(component, statistic.StatType);
+    if (row == INDEX_NONE) {
+        return;
+    }
+
+    Values[row] = statistic.CurrentValue;
+    if (bResetDelay && RegenDelays[row] > 0.f) {
+        ResumeTimes[row] = GetWorld()->GetTimeSeconds() + RegenDelays[row];
+    }
+    WakeRow(row);
+}
+
+void UARSRegenerationSubsystem::UpdateRegeneration()
+{
+    const float currentTime = GetWorld()->GetTimeSeconds();
+    const float deltaTime = currentTime - LastUpdateTime;
+    LastUpdateTime = currentTime;
+
+    if (deltaTime <= 0.f) {
+        return;
+    }
+
+    // Rows whose regen delay expired start regenerating
+    for (int32 index = DelayedRows.Num() - 1; index >= 0; --index) {
+        const int32 row = DelayedRows[index];
+        if (currentTime >= ResumeTimes[row]) {
+            DelayedRows.RemoveAtSwap(index, 1, EAllowShrinking::No);
+            RowStates[row] = Sleeping;
+            WakeRow(row);
+        }
+    }
+
+    RegeneratedValues.Reset();
+    for (int32 index = ActiveRows.Num() - 1; index >= 0; --index) {
+        const int32 row = ActiveRows[index];
+        const float newValue = FMath::Clamp(Values[row] + RegenRates[row] * deltaTime, MinValues[row], MaxValues[row]);
+        if (newValue != Values[row]) {
+            Values[row] = newValue;
+            RegeneratedValues.Add({ Components[row], StatTypes[row], newValue });
+        }
+
+        // Full or empty, sleeps until the stat is modified again
+        if (IsRowSaturated(row)) {
+            ActiveRows.RemoveAtSwap(index, 1, EAllowShrinking::No);
+            RowStates[row] = Sleeping;
+        }
+    }
+
+    for (const FRegeneratedValue& regenerated : RegeneratedValues) {
+        if (UARSStatisticsComponent* component = regenerated.Component.Get()) {
+            component->ApplyRegeneratedValue(regenerated.StatType, regenerated.Value);
+        }
+    }
+}
+
+int32 UARSRegenerationSubsystem::AllocateRow()
+{
+    if (FreeRows.Num() > 0) {
+        return FreeRows.Pop(EAllowShrinking::No);
+    }
+
+    Components.AddDefaulted();
+    StatTypes.AddDefaulted();
+    Values.Add(0.f);
+    MinValues.Add(0.f);
+    MaxValues.Add(0.f);
+    RegenRates.Add(0.f);
+    RegenDelays.Add(0.f);
+    ResumeTimes.Add(0.f);
+    RowStates.Add(Sleeping);
+    return Values.Num() - 1;
+}
+
+void UARSRegenerationSubsystem::FreeRow(int32 row)
+{
+    SetRowState(row, Sleeping);
+    Components[row] = nullptr;
+    StatTypes[row] = FGameplayTag();
+    Values[row] = 0.f;
+    MinValues[row] = 0.f;
+    MaxValues[row] = 0.f;
+    RegenRates[row] = 0.f;
+    RegenDelays[row] = 0.f;
+    ResumeTimes[row] = 0.f;
+    FreeRows.Add(row);
+}
+
+void UARSRegenerationSubsystem::WriteRow(int32 row, const FStatistic& statistic)
+{
+    Values[row] = statistic.CurrentValue;
+    MinValues[row] = statistic.bClampToZero ? 0.f : -BIG_NUMBER;
+    MaxValues[row] = statistic.MaxValue;
+    RegenRates[row] = statistic.RegenValue;
+    RegenDelays[row] = statistic.RegenDelay;
+}
+
+void UARSRegenerationSubsystem::WakeRow(int32 row)
+{
+    if (RegenRates[row] == 0.f) {
+        SetRowState(row, Sleeping);
+    } else if (GetWorld()->GetTimeSeconds() < ResumeTimes[row]) {
+        SetRowState(row, Delayed);
+    } else {
+        SetRowState(row, IsRowSaturated(row) ? Sleeping : Active);
+    }
+}
+
+void UARSRegenerationSubsystem::SetRowState(int32 row, ERowState newState)
+{
+    const ERowState oldState = static_cast<ERowState>(RowStates[row]);
+    if (oldState == newState) {
+        return;
+    }
+
+    if (oldState == Active) {
+        ActiveRows.RemoveSwap(row, EAllowShrinking::No);
+    } else if (oldState == Delayed) {
+        DelayedRows.RemoveSwap(row, EAllowShrinking::No);
+    }
+
+    if (newState == Active) {
+        ActiveRows.Add(row);
+    } else if (newState == Delayed) {
+        DelayedRows.Add(row);
+    }
+    RowStates[row] = newState;
+}
+
+bool UARSRegenerationSubsystem::IsRowSaturated(int32 row) const
+{
+    return RegenRates[row] > 0.f ? Values[row] >= MaxValues[row] : Values[row] <= MinValues[row];
+}
+
+int32 UARSRegenerationSubsystem::FindRow(const UARSStatisticsComponent* component, const FGameplayTag& statType) const
+{
+    if (const TArray<int32>* rows = ComponentRows.Find(component)) {
+        for (const int32 row : *rows) {
+            if (StatTypes[row] == statType) {
+                return row;
+            }
+        }
+    }
+    return INDEX_NONE;
+}
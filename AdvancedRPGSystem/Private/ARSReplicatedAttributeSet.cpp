@@ -0,0 +1,130 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ARSReplicatedAttributeSet.h"
+#include "ARSStatisticsComponent.h"
+
+namespace {
+bool HasSameDefinition(const FStatistic& first, const FStatistic& second)
+{
+    return first.MaxValue == second.MaxValue && first.RegenValue == second.RegenValue && first.RegenDelay == second.RegenDelay
+        && first.HasRegeneration == second.HasRegeneration && first.bStartFromZero == second.bStartFromZero && first.bClampToZero == second.bClampToZero;
+}
+}
+
+bool FARSQuantizedStatValue::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    // Zigzag encoded, so small negative values stay small once packed
+    uint32 packed = 0;
+    if (Ar.IsSaving()) {
+        const int32 quantized = Quantize(Value);
+        packed = (static_cast<uint32>(quantized) << 1) ^ static_cast<uint32>(quantized >> 31);
+    }
+
+    Ar.SerializeIntPacked(packed);
+
+    if (Ar.IsLoading()) {
+        const int32 quantized = static_cast<int32>(packed >> 1) ^ -static_cast<int32>(packed & 1);
+        Value = quantized / 100.f;
+    }
+
+    bOutSuccess = true;
+    return true;
+}
+
+void FARSAttributeArray::Sync(const TArray<FAttribute>& source)
+{
+    const int32 oldNum = Items.Num();
+    Items.RemoveAllSwap([&source](const FARSAttributeItem& item) { return !source.Contains(item.Attribute.AttributeType); });
+    if (Items.Num() != oldNum) {
+        MarkArrayDirty();
+    }
+
+    for (const FAttribute& attribute : source) {
+        FARSAttributeItem* item = Items.FindByPredicate([&attribute](const FARSAttributeItem& current) { return current.Attribute == attribute; });
+        if (!item) {
+            item = &Items.AddDefaulted_GetRef();
+            item->Attribute = attribute;
+            MarkItemDirty(*item);
+        } else if (item->Attribute.Value != attribute.Value) {
+            item->Attribute.Value = attribute.Value;
+            MarkItemDirty(*item);
+        }
+    }
+}
+
+void FARSAttributeArray::CopyTo(TArray<FAttribute>& outAttributes) const
+{
+    outAttributes.Reset(Items.Num());
+    for (const FARSAttributeItem& item : Items) {
+        outAttributes.Add(item.Attribute);
+    }
+}
+
+void FARSAttributeArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (Owner) {
+        Owner->HandleReplicatedDefinitions();
+    }
+}
+
+void FARSStatisticArray::Sync(const TArray<FStatistic>& source)
+{
+    const int32 oldNum = Items.Num();
+    Items.RemoveAllSwap([&source](const FARSStatisticItem& item) { return !source.Contains(item.Statistic.StatType); });
+    if (Items.Num() != oldNum) {
+        MarkArrayDirty();
+    }
+
+    for (const FStatistic& statistic : source) {
+        FARSStatisticItem* item = Items.FindByPredicate([&statistic](const FARSStatisticItem& current) { return current.Statistic == statistic; });
+        if (!item) {
+            item = &Items.AddDefaulted_GetRef();
+            item->Statistic = statistic;
+            MarkItemDirty(*item);
+        } else if (!HasSameDefinition(item->Statistic, statistic)) {
+            item->Statistic = statistic;
+            MarkItemDirty(*item);
+        }
+    }
+}
+
+void FARSStatisticArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (Owner) {
+        Owner->HandleReplicatedDefinitions();
+    }
+}
+
+void FARSStatisticValueArray::Sync(const TArray<FStatistic>& source)
+{
+    const int32 oldNum = Items.Num();
+    Items.RemoveAllSwap([&source](const FARSStatisticValueItem& item) { return !source.Contains(item.StatType); });
+    if (Items.Num() != oldNum) {
+        MarkArrayDirty();
+    }
+
+    for (const FStatistic& statistic : source) {
+        SetValue(statistic.StatType, statistic.CurrentValue);
+    }
+}
+
+void FARSStatisticValueArray::SetValue(const FGameplayTag& statType, float value)
+{
+    FARSStatisticValueItem* item = Items.FindByPredicate([&statType](const FARSStatisticValueItem& current) { return current.StatType == statType; });
+    if (!item) {
+        item = &Items.AddDefaulted_GetRef();
+        item->StatType = statType;
+        item->CurrentValue = value;
+        MarkItemDirty(*item);
+    } else if (FARSQuantizedStatValue::Quantize(item->CurrentValue.Value) != FARSQuantizedStatValue::Quantize(value)) {
+        item->CurrentValue = value;
+        MarkItemDirty(*item);
+    }
+}
+
+void FARSStatisticValueArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (Owner) {
+        Owner->HandleReplicatedValues();
+    }
+}
@@ -3,6 +3,7 @@
 #include "ARSStatisticsComponent.h"
 #include "ARSFunctionLibrary.h"
 #include "ARSLevelingSystemDataAsset.h"
+#include "ARSRegenerationSubsystem.h"
 #include "ARSTypes.h"
 #include "Net/UnrealNetwork.h"
 #include <Curves/CurveFloat.h>
@@ -11,6 +12,16 @@
 #include <Kismet/KismetSystemLibrary.h>
 #include <TimerManager.h>
 
+namespace {
+/*Copies into the existing allocation, which only grows when source is bigger*/
+template <typename ElementType>
+void CopyInPlace(TArray<ElementType>& dest, const TArray<ElementType>& source)
+{
+    dest.Reset(source.Num());
+    dest.Append(source);
+}
+}
+
 // Sets default values for this component's properties
 UARSStatisticsComponent::UARSStatisticsComponent()
 {
@@ -27,8 +38,22 @@ void UARSStatisticsComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(UARSStatisticsComponent, AttributeSet);
-    DOREPLIFETIME(UARSStatisticsComponent, baseAttributeSet);
+    DOREPLIFETIME(UARSStatisticsComponent, ReplicatedAttributes);
+    DOREPLIFETIME(UARSStatisticsComponent, ReplicatedParameters);
+    DOREPLIFETIME(UARSStatisticsComponent, ReplicatedStatistics);
+    DOREPLIFETIME(UARSStatisticsComponent, ReplicatedStatisticValues);
+    DOREPLIFETIME_CONDITION(UARSStatisticsComponent, baseAttributeSet, COND_OwnerOnly);
+}
+
+void UARSStatisticsComponent::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    // Set after the archetype copy, so every instance points to itself
+    ReplicatedAttributes.Owner = this;
+    ReplicatedParameters.Owner = this;
+    ReplicatedStatistics.Owner = this;
+    ReplicatedStatisticValues.Owner = this;
 }
 
 void UARSStatisticsComponent::InitializeAttributeSet()
@@ -73,29 +98,55 @@ void UARSStatisticsComponent::TickComponent(float DeltaTime, ELevelTick TickType
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 }
 
-void UARSStatisticsComponent::RegenerateStat()
+void UARSStatisticsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    for (const auto& elem : AttributeSet.Statistics) {
-        if (elem.HasRegeneration) {
-            if (regenDelay.Contains(elem.StatType)) {
-                FDateTime* before = regenDelay.Find(elem.StatType);
-                if (before) {
-                    const FTimespan delay = FDateTime::Now() - *before;
-                    if (delay.GetSeconds() > elem.RegenDelay) {
-                        regenDelay.Remove(elem.StatType);
-                    } else if (elem.RegenValue != 0.f) {
-                        continue;
-                    }
-                }
-            }
-            FStatisticValue modifier;
-            modifier.Statistic = elem.StatType;
-            modifier.Value = elem.RegenValue * RegenerationTimeInterval;
-            Internal_ModifyStat(modifier, false);
+    if (bIsRegenerationStarted) {
+        if (UARSRegenerationSubsystem* regenSubsystem = GetRegenerationSubsystem()) {
+            regenSubsystem->UnregisterComponent(this);
+        }
+        bIsRegenerationStarted = false;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+UARSRegenerationSubsystem* UARSStatisticsComponent::GetRegenerationSubsystem() const
+{
+    const UWorld* world = GetWorld();
+    return world ? world->GetSubsystem<UARSRegenerationSubsystem>() : nullptr;
+}
+
+void UARSStatisticsComponent::RefreshRegeneration()
+{
+    if (bIsRegenerationStarted) {
+        if (UARSRegenerationSubsystem* regenSubsystem = GetRegenerationSubsystem()) {
+            regenSubsystem->RegisterComponent(this, AttributeSet.Statistics);
         }
     }
 }
 
+void UARSStatisticsComponent::ApplyRegeneratedValue(const FGameplayTag& statType, float newValue)
+{
+    FStatistic* stat = AttributeSet.FindStatistic(statType);
+    if (stat && stat->CurrentValue != newValue) {
+        const float oldValue = stat->CurrentValue;
+        stat->CurrentValue = newValue;
+        BroadcastStatisticChanged(*stat, oldValue);
+    }
+}
+
+void UARSStatisticsComponent::BroadcastStatisticChanged(const FStatistic& stat, float oldValue)
+{
+    if (GetOwner()->HasAuthority()) {
+        ReplicatedStatisticValues.SetValue(stat.StatType, stat.CurrentValue);
+    }
+    OnAttributeSetModified.Broadcast();
+    OnStatisticChanged.Broadcast(stat.StatType, oldValue, stat.CurrentValue);
+    if (FMath::IsNearlyZero(stat.CurrentValue)) {
+        OnStatisiticReachesZero.Broadcast(stat.StatType);
+    }
+}
+
 void UARSStatisticsComponent::AddAttributeSetModifier_Implementation(const FAttributesSetModifier& attModifier)
 {
 
@@ -123,21 +174,23 @@ void UARSStatisticsComponent::Internal_AddModifier(const FAttributesSetModifier&
 void UARSStatisticsComponent::GenerateStats()
 {
 
-    TArray<FStatistic> currentValuesCopy;
-    for (const FStatistic& stat : AttributeSet.Statistics) {
-        currentValuesCopy.Add(stat);
-    }
+    // Keeps the old statistics with their layout, so the rescale below is a slot lookup per stat.
+    // The swap hands the allocation of the generation before to AttributeSet
+    Swap(PreviousStatistics.Statistics, AttributeSet.Statistics);
+    PreviousStatistics.RefreshLayout();
 
     CalcualtePrimaryStats();
     GenerateSecondaryStat();
 
     for (FStatistic& stat : AttributeSet.Statistics) {
-        FStatistic* oldStat = currentValuesCopy.FindByKey(stat);
+        const FStatistic* oldStat = PreviousStatistics.FindStatistic(stat.StatType);
         if (oldStat) {
             stat.CurrentValue = UARSFunctionLibrary::GetNewCurrentValueForNewMaxValue(oldStat->CurrentValue, oldStat->MaxValue, stat.MaxValue);
         }
     }
-    AttributeSet.Sort();
+    AttributeSet.RefreshLayout();
+    SyncReplicatedAttributeSet();
+    RefreshRegeneration();
     OnAttributeSetModified.Broadcast();
 }
 
@@ -146,7 +199,7 @@ void UARSStatisticsComponent::Internal_ModifyStat(const FStatisticValue& StatMod
     if (!bIsInitialized)
         return;
 
-    FStatistic* stat = AttributeSet.Statistics.FindByKey(StatMod.Statistic);
+    FStatistic* stat = AttributeSet.FindStatistic(StatMod.Statistic);
 
     if (stat) {
         const float oldValue = stat->CurrentValue;
@@ -158,30 +211,28 @@ void UARSStatisticsComponent::Internal_ModifyStat(const FStatisticValue& StatMod
             stat->CurrentValue = FMath::Clamp(stat->CurrentValue, -BIG_NUMBER, stat->MaxValue);
         }
 
-        if (bResetDelay && stat->HasRegeneration && stat->RegenDelay > 0.f) {
-            regenDelay.Add(stat->StatType, FDateTime::Now());
+        if (bIsRegenerationStarted && stat->HasRegeneration) {
+            if (UARSRegenerationSubsystem* regenSubsystem = GetRegenerationSubsystem()) {
+                regenSubsystem->NotifyStatModified(this, *stat, bResetDelay);
+            }
         }
         // AttributeSet.Sort();
         if (oldValue != stat->CurrentValue) {
-            OnAttributeSetModified.Broadcast();
-            OnStatisticChanged.Broadcast(stat->StatType, oldValue, stat->CurrentValue);
-            if (FMath::IsNearlyZero(stat->CurrentValue)) {
-                OnStatisiticReachesZero.Broadcast(stat->StatType);
-            }
+            BroadcastStatisticChanged(*stat, oldValue);
         }
     }
 }
 
 void UARSStatisticsComponent::CalcualtePrimaryStats()
 {
-    AttributeSet.Attributes = baseAttributeSet.Attributes;
+    CopyInPlace(AttributeSet.Attributes, baseAttributeSet.Attributes);
 
     for (const FAttributesSetModifier& attModifier : activeModifiers) {
 
         for (const auto& att : attModifier.PrimaryAttributesMod) {
             ensure(UARSFunctionLibrary::IsValidAttributeTag(att.AttributeType));
             if (UARSFunctionLibrary::IsValidAttributeTag(att.AttributeType)) {
-                FAttribute* _originalatt = AttributeSet.Attributes.FindByKey(att);
+                FAttribute* _originalatt = AttributeSet.FindAttribute(att.AttributeType);
                 if (_originalatt) {
                     *(_originalatt) = *(_originalatt) + att;
                 } else {
@@ -199,7 +250,7 @@ void UARSStatisticsComponent::CalcualteSecondaryStats()
 
             ensure(UARSFunctionLibrary::IsValidParameterTag(att.AttributeType));
             if (UARSFunctionLibrary::IsValidParameterTag(att.AttributeType)) {
-                FAttribute* _originalatt = AttributeSet.Parameters.FindByKey(att);
+                FAttribute* _originalatt = AttributeSet.FindParameter(att.AttributeType);
                 if (_originalatt) {
                     *(_originalatt) = *(_originalatt) + att;
                 } else {
@@ -211,7 +262,7 @@ void UARSStatisticsComponent::CalcualteSecondaryStats()
         for (const auto& att : attModifier.StatisticsMod) {
             ensure(UARSFunctionLibrary::IsValidStatisticTag(att.AttributeType));
             if (UARSFunctionLibrary::IsValidStatisticTag(att.AttributeType)) {
-                FStatistic* _originalatt = AttributeSet.Statistics.FindByKey(att);
+                FStatistic* _originalatt = AttributeSet.FindStatistic(att.AttributeType);
                 if (_originalatt) {
                     *(_originalatt) = *(_originalatt) + att;
                 } else {
@@ -230,7 +281,7 @@ FAttributesSetModifier UARSStatisticsComponent::CreateAdditiveAttributeSetModifi
 
     for (const auto& att : attModifier.PrimaryAttributesMod) {
         if (att.ModType == EModifierType::EPercentage) {
-            const FAttribute* originalatt = AttributeSet.Attributes.FindByKey(att);
+            const FAttribute* originalatt = AttributeSet.FindAttribute(att.AttributeType);
             if (originalatt) {
                 const float newval = originalatt->Value * att.Value / 100.f;
                 const FAttributeModifier newMod(att.AttributeType, EModifierType::EAdditive, newval);
@@ -243,7 +294,7 @@ FAttributesSetModifier UARSStatisticsComponent::CreateAdditiveAttributeSetModifi
     }
     for (const auto& att : attModifier.AttributesMod) {
         if (att.ModType == EModifierType::EPercentage) {
-            const FAttribute* originalatt = AttributeSet.Parameters.FindByKey(att);
+            const FAttribute* originalatt = AttributeSet.FindParameter(att.AttributeType);
             if (originalatt) {
                 const float newval = originalatt->Value * att.Value / 100.f;
                 const FAttributeModifier newMod(att.AttributeType, EModifierType::EAdditive, newval);
@@ -255,7 +306,7 @@ FAttributesSetModifier UARSStatisticsComponent::CreateAdditiveAttributeSetModifi
         }
     }
     for (const auto& stat : attModifier.StatisticsMod) {
-        const FStatistic* originalatt = AttributeSet.Statistics.FindByKey(stat);
+        const FStatistic* originalatt = AttributeSet.FindStatistic(stat.AttributeType);
         if (stat.ModType == EModifierType::EPercentage) {
             if (originalatt) {
 
@@ -274,31 +325,112 @@ FAttributesSetModifier UARSStatisticsComponent::CreateAdditiveAttributeSetModifi
 
 void UARSStatisticsComponent::GenerateSecondaryStat()
 {
-    AttributeSet.Parameters = DefaultAttributeSet.Parameters;
-    AttributeSet.Statistics = DefaultAttributeSet.Statistics;
+    if (StatsLoadMethod == EStatsLoadMethod::EUseDefaultsWithoutGeneration) {
+        CopyInPlace(AttributeSet.Parameters, DefaultAttributeSet.Parameters);
+        CopyInPlace(AttributeSet.Statistics, DefaultAttributeSet.Statistics);
+    } else if (bCurveOutputsValid && HasSameCurveInputTypes()) {
+        // Secondary stats only depend on the primary attributes, only the ones read by the curves of a changed attribute are evaluated again
+        CopyInPlace(AttributeSet.Parameters, CurveOutputs.Parameters);
+        CopyInPlace(AttributeSet.Statistics, CurveOutputs.Statistics);
+        if (CollectDirtyCurveOutputs()) {
+            AttributeSet.RefreshLayout();
+            ResetDirtyCurveOutputs();
+            GenerateSecondaryStatFromCurrentPrimaryStat(&DirtyCurveParameters, &DirtyCurveStatistics);
+
+            CopyInPlace(CurveOutputs.Parameters, AttributeSet.Parameters);
+            CopyInPlace(CurveOutputs.Statistics, AttributeSet.Statistics);
+        }
+        CopyInPlace(CurveInputs, AttributeSet.Attributes);
+    } else {
+        CopyInPlace(AttributeSet.Parameters, DefaultAttributeSet.Parameters);
+        CopyInPlace(AttributeSet.Statistics, DefaultAttributeSet.Statistics);
+        AttributeSet.RefreshLayout();
+        CurveInputsEvaluatedNum = GenerateSecondaryStatFromCurrentPrimaryStat();
 
-    if (StatsLoadMethod != EStatsLoadMethod::EUseDefaultsWithoutGeneration) {
-        GenerateSecondaryStatFromCurrentPrimaryStat();
-        //         baseAttributeSet.Parameters = AttributeSet.Parameters;
-        //         baseAttributeSet.Statistics = AttributeSet.Statistics;
+        CopyInPlace(CurveInputs, AttributeSet.Attributes);
+        CopyInPlace(CurveOutputs.Parameters, AttributeSet.Parameters);
+        CopyInPlace(CurveOutputs.Statistics, AttributeSet.Statistics);
+        bCurveOutputsValid = true;
     }
+    AttributeSet.RefreshLayout();
     CalcualteSecondaryStats();
 }
 
-void UARSStatisticsComponent::GenerateSecondaryStatFromCurrentPrimaryStat()
+bool UARSStatisticsComponent::HasSameCurveInputTypes() const
+{
+    if (CurveInputs.Num() != AttributeSet.Attributes.Num()) {
+        return false;
+    }
+    for (int32 index = 0; index < CurveInputs.Num(); ++index) {
+        if (CurveInputs[index].AttributeType != AttributeSet.Attributes[index].AttributeType) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UARSStatisticsComponent::CollectDirtyCurveOutputs()
+{
+    DirtyCurveParameters.Reset();
+    DirtyCurveStatistics.Reset();
+
+    // Attributes after the first one without rules were never evaluated
+    for (int32 index = 0; index < CurveInputsEvaluatedNum; ++index) {
+        const FAttribute& current = AttributeSet.Attributes[index];
+        FGenerationRule rules;
+        if (CurveInputs[index].Value == current.Value || !UARSFunctionLibrary::TryGetGenerationRuleByPrimaryAttributeType(current.AttributeType, rules)) {
+            continue;
+        }
+
+        for (const FAttributeInfluence& att : rules.InfluencedParameters) {
+            if (att.CurveValue) {
+                DirtyCurveParameters.Add(att.TargetParameter);
+            }
+        }
+        for (const FStatInfluence& stat : rules.InfluencedStatistics) {
+            if (stat.CurveMaxValue || stat.CurveRegenValue) {
+                DirtyCurveStatistics.Add(stat.TargetStat);
+            }
+        }
+    }
+    return DirtyCurveParameters.Num() > 0 || DirtyCurveStatistics.Num() > 0;
+}
+
+void UARSStatisticsComponent::ResetDirtyCurveOutputs()
 {
+    // Back to the values a full generation starts from, entries created by the curves start from zero
+    for (const FGameplayTag& paramTag : DirtyCurveParameters) {
+        if (FAttribute* param = AttributeSet.FindParameter(paramTag)) {
+            const FAttribute* defaultParam = DefaultAttributeSet.FindParameter(paramTag);
+            *param = defaultParam ? *defaultParam : FAttribute(paramTag, 0.f);
+        }
+    }
+    for (const FGameplayTag& statTag : DirtyCurveStatistics) {
+        if (FStatistic* stat = AttributeSet.FindStatistic(statTag)) {
+            const FStatistic* defaultStat = DefaultAttributeSet.FindStatistic(statTag);
+            *stat = defaultStat ? *defaultStat : FStatistic(statTag, 0.f, 0.f);
+        }
+    }
+}
 
+int32 UARSStatisticsComponent::GenerateSecondaryStatFromCurrentPrimaryStat(const TSet<FGameplayTag>* dirtyParameters, const TSet<FGameplayTag>* dirtyStatistics)
+{
+    int32 evaluatedNum = 0;
     for (const FAttribute& primaryatt : AttributeSet.Attributes) {
         FGenerationRule rules;
 
         if (!UARSFunctionLibrary::TryGetGenerationRuleByPrimaryAttributeType(primaryatt.AttributeType, rules)) {
 
-            return;
+            return evaluatedNum;
         }
+        ++evaluatedNum;
 
         for (const FAttributeInfluence& att : rules.InfluencedParameters) {
+            if (dirtyParameters && !dirtyParameters->Contains(att.TargetParameter)) {
+                continue;
+            }
             if (att.CurveValue) {
-                FAttribute* targetAttribute = AttributeSet.Parameters.FindByKey(att.TargetParameter);
+                FAttribute* targetAttribute = AttributeSet.FindParameter(att.TargetParameter);
                 if (targetAttribute) {
                     targetAttribute->Value += att.CurveValue->GetFloatValue(primaryatt.Value);
                 } else {
@@ -310,9 +442,12 @@ void UARSStatisticsComponent::GenerateSecondaryStatFromCurrentPrimaryStat()
         }
 
         for (const FStatInfluence& stat : rules.InfluencedStatistics) {
+            if (dirtyStatistics && !dirtyStatistics->Contains(stat.TargetStat)) {
+                continue;
+            }
 
             if (stat.CurveMaxValue) {
-                FStatistic* targetStat = AttributeSet.Statistics.FindByKey(stat.TargetStat);
+                FStatistic* targetStat = AttributeSet.FindStatistic(stat.TargetStat);
                 if (targetStat) {
                     targetStat->MaxValue += stat.CurveMaxValue->GetFloatValue(primaryatt.Value);
                     targetStat->CurrentValue = targetStat->bStartFromZero ? 0.f : targetStat->MaxValue;
@@ -322,32 +457,32 @@ void UARSStatisticsComponent::GenerateSecondaryStatFromCurrentPrimaryStat()
                     AttributeSet.Statistics.AddUnique(localstat);
                 }
             }
-            FStatistic* targetStat = AttributeSet.Statistics.FindByKey(stat.TargetStat);
+            FStatistic* targetStat = AttributeSet.FindStatistic(stat.TargetStat);
             if (targetStat && stat.CurveRegenValue) {
                 targetStat->RegenValue += stat.CurveRegenValue->GetFloatValue(primaryatt.Value);
                 targetStat->HasRegeneration = targetStat->RegenValue != 0.f;
             }
         }
     }
+    return evaluatedNum;
 }
 
 void UARSStatisticsComponent::StartRegeneration_Implementation()
 {
     if (!bIsRegenerationStarted && bCanRegenerateStatistics) {
-        UWorld* world = GetWorld();
-        if (world) {
-            world->GetTimerManager().SetTimer(RegenTimer, this, &UARSStatisticsComponent::RegenerateStat, RegenerationTimeInterval, true);
+        if (UARSRegenerationSubsystem* regenSubsystem = GetRegenerationSubsystem()) {
             bIsRegenerationStarted = true;
+            regenSubsystem->RegisterComponent(this, AttributeSet.Statistics);
         }
     }
 }
 
 void UARSStatisticsComponent::StopRegeneration_Implementation()
 {
-    if (bIsRegenerationStarted && RegenTimer.IsValid()) {
-        UWorld* world = GetWorld();
-        // Calling MyUsefulFunction after 5 seconds without looping
-        world->GetTimerManager().ClearTimer(RegenTimer);
+    if (bIsRegenerationStarted) {
+        if (UARSRegenerationSubsystem* regenSubsystem = GetRegenerationSubsystem()) {
+            regenSubsystem->UnregisterComponent(this);
+        }
         bIsRegenerationStarted = false;
     }
 }
@@ -399,7 +534,7 @@ bool UARSStatisticsComponent::CheckPrimaryAttributesRequirements(const TArray<FA
                      "CheckPrimaryAttributeRequirements"));
             return false;
         }
-        const FAttribute* localatt = AttributeSet.Attributes.FindByKey(att.AttributeType);
+        const FAttribute* localatt = AttributeSet.FindAttribute(att.AttributeType);
         if (localatt && localatt->Value < att.Value)
             return false;
     }
@@ -408,7 +543,7 @@ bool UARSStatisticsComponent::CheckPrimaryAttributesRequirements(const TArray<FA
 
 bool UARSStatisticsComponent::CheckCost(const FStatisticValue& Cost) const
 {
-    const FStatistic* stat = AttributeSet.Statistics.FindByKey(Cost.Statistic);
+    const FStatistic* stat = AttributeSet.FindStatistic(Cost.Statistic);
     if (stat) {
         return stat->CurrentValue > (Cost.Value * GetConsumptionMultiplierByStatistic(stat->StatType));
     } else {
@@ -431,9 +566,48 @@ void UARSStatisticsComponent::OnRep_AttributeSet()
     OnAttributeSetModified.Broadcast();
 }
 
+void UARSStatisticsComponent::SyncReplicatedAttributeSet()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority()) {
+        return;
+    }
+
+    ReplicatedAttributes.Sync(AttributeSet.Attributes);
+    ReplicatedParameters.Sync(AttributeSet.Parameters);
+    ReplicatedStatistics.Sync(AttributeSet.Statistics);
+    ReplicatedStatisticValues.Sync(AttributeSet.Statistics);
+}
+
+void UARSStatisticsComponent::HandleReplicatedDefinitions()
+{
+    ReplicatedAttributes.CopyTo(AttributeSet.Attributes);
+    ReplicatedParameters.CopyTo(AttributeSet.Parameters);
+
+    AttributeSet.Statistics.Reset(ReplicatedStatistics.Items.Num());
+    for (const FARSStatisticItem& item : ReplicatedStatistics.Items) {
+        FStatistic& stat = AttributeSet.Statistics.Add_GetRef(item.Statistic);
+        if (const FARSStatisticValueItem* value = ReplicatedStatisticValues.FindValue(stat.StatType)) {
+            stat.CurrentValue = value->CurrentValue.Value;
+        }
+    }
+    AttributeSet.RefreshLayout();
+    OnRep_AttributeSet();
+}
+
+void UARSStatisticsComponent::HandleReplicatedValues()
+{
+    for (const FARSStatisticValueItem& value : ReplicatedStatisticValues.Items) {
+        if (FStatistic* stat = AttributeSet.FindStatistic(value.StatType)) {
+            stat->CurrentValue = value.CurrentValue.Value;
+        }
+    }
+    OnRep_AttributeSet();
+}
+
 void UARSStatisticsComponent::Internal_InitializeStats()
 {
     bIsInitialized = false;
+    bCurveOutputsValid = false;
 
     AttributeSet.Statistics.Empty();
     AttributeSet.Attributes.Empty();
@@ -463,6 +637,8 @@ void UARSStatisticsComponent::Internal_InitializeStats()
     for (auto& statistic : AttributeSet.Statistics) {
         statistic.CurrentValue = statistic.bStartFromZero ? 0.f : statistic.MaxValue;
     }
+    SyncReplicatedAttributeSet();
+    RefreshRegeneration();
 
     bIsInitialized = true;
 
@@ -494,7 +670,7 @@ float UARSStatisticsComponent::GetCurrentValueForStatitstic(FGameplayTag stat) c
         return 0.f;
     }
 
-    const FStatistic* intStat = AttributeSet.Statistics.FindByKey(stat);
+    const FStatistic* intStat = AttributeSet.FindStatistic(stat);
 
     if (intStat) {
         return intStat->CurrentValue;
@@ -509,7 +685,7 @@ float UARSStatisticsComponent::GetMaxValueForStatitstic(FGameplayTag stat) const
         return 0.f;
     }
 
-    const FStatistic* intStat = AttributeSet.Statistics.FindByKey(stat);
+    const FStatistic* intStat = AttributeSet.FindStatistic(stat);
 
     if (intStat) {
         return intStat->MaxValue;
@@ -536,8 +712,8 @@ FStatistic UARSStatisticsComponent::GetFullStatisticStructure(FGameplayTag stat)
         UE_LOG(LogTemp, Warning, TEXT("INVALID STATISTIC TAG - %s - ARSStatisticsComponent::GetFullStatisticStructure"), *stat.ToString());
         return FStatistic();
     }
-    if (AttributeSet.Statistics.Contains(stat)) {
-        return *AttributeSet.Statistics.FindByKey(stat);
+    if (const FStatistic* intStat = AttributeSet.FindStatistic(stat)) {
+        return *intStat;
     }
 
     UE_LOG(LogTemp, Warning, TEXT("INVALID STATISTIC TAG - %s - ARSStatisticsComponent::GetFullStatisticStructure"), *stat.ToString());
@@ -551,7 +727,7 @@ float UARSStatisticsComponent::GetCurrentPrimaryAttributeValue(FGameplayTag attr
         return 0.f;
     }
 
-    const FAttribute* intStat = AttributeSet.Attributes.FindByKey(attributeTag);
+    const FAttribute* intStat = AttributeSet.FindAttribute(attributeTag);
 
     if (intStat) {
         return intStat->Value;
@@ -569,7 +745,7 @@ float UARSStatisticsComponent::GetCurrentAttributeValue(FGameplayTag attributeTa
         return 0.f;
     }
 
-    const FAttribute* intStat = AttributeSet.Parameters.FindByKey(attributeTag);
+    const FAttribute* intStat = AttributeSet.FindParameter(attributeTag);
 
     if (intStat) {
         return intStat->Value;
@@ -598,7 +774,7 @@ void UARSStatisticsComponent::AssignPerkToPrimaryAttribute_Implementation(FGamep
 
 void UARSStatisticsComponent::PermanentlyModifyPrimaryAttribute_Implementation(FGameplayTag attribute, float deltaValue /*= 1.0f*/)
 {
-    const FAttribute* currValue = DefaultAttributeSet.Attributes.FindByKey(attribute);
+    const FAttribute* currValue = DefaultAttributeSet.FindAttribute(attribute);
     if (currValue) {
         FAttribute newValue(currValue->AttributeType, currValue->Value + deltaValue);
         DefaultAttributeSet.Attributes.Remove(newValue);
@@ -619,8 +795,12 @@ TArray<FAttribute> UARSStatisticsComponent::GetPrimitiveAttributesForCurrentLeve
 
 void UARSStatisticsComponent::OnComponentLoaded_Implementation()
 {
+    bCurveOutputsValid = false;
     if (StatsLoadMethod != EStatsLoadMethod::EUseDefaultsWithoutGeneration) {
         GenerateStats();
+    } else {
+        SyncReplicatedAttributeSet();
+        RefreshRegeneration();
     }
 }
 
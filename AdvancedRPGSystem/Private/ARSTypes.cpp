@@ -2,5 +2,48 @@
 
 #include "ARSTypes.h"
 
+namespace {
+template <typename ElementType>
+void AddSlots(const TArray<ElementType>& elements, TMap<FGameplayTag, int32>& outSlots, const FGameplayTag& (*getTag)(const ElementType&))
+{
+    outSlots.Reserve(elements.Num());
+    for (int32 index = 0; index < elements.Num(); ++index) {
+        outSlots.Add(getTag(elements[index]), index);
+    }
+}
 
+template <typename ElementType>
+bool MatchesSlots(const TArray<ElementType>& elements, const TMap<FGameplayTag, int32>& slots, const FGameplayTag& (*getTag)(const ElementType&))
+{
+    // Duplicated tags map to their last slot, lookups validate the slot so a loose match is still safe
+    if (slots.Num() > elements.Num()) {
+        return false;
+    }
+    for (const ElementType& element : elements) {
+        const int32* slot = slots.Find(getTag(element));
+        if (!slot || !elements.IsValidIndex(*slot) || getTag(elements[*slot]) != getTag(element)) {
+            return false;
+        }
+    }
+    return true;
+}
 
+const FGameplayTag& GetAttributeTag(const FAttribute& attribute) { return attribute.AttributeType; }
+const FGameplayTag& GetStatisticTag(const FStatistic& statistic) { return statistic.StatType; }
+}
+
+TSharedRef<const FARSAttributeSetLayout> FARSAttributeSetLayout::Create(const TArray<FAttribute>& attributes, const TArray<FStatistic>& statistics, const TArray<FAttribute>& parameters)
+{
+    TSharedRef<FARSAttributeSetLayout> layout = MakeShared<FARSAttributeSetLayout>();
+    AddSlots(attributes, layout->AttributeSlots, &GetAttributeTag);
+    AddSlots(statistics, layout->StatisticSlots, &GetStatisticTag);
+    AddSlots(parameters, layout->ParameterSlots, &GetAttributeTag);
+    return layout;
+}
+
+bool FARSAttributeSetLayout::Matches(const TArray<FAttribute>& attributes, const TArray<FStatistic>& statistics, const TArray<FAttribute>& parameters) const
+{
+    return MatchesSlots(attributes, AttributeSlots, &GetAttributeTag)
+        && MatchesSlots(statistics, StatisticSlots, &GetStatisticTag)
+        && MatchesSlots(parameters, ParameterSlots, &GetAttributeTag);
+}
@@ -40,6 +40,10 @@ public:
     UPROPERTY(EditAnywhere, config, Category = ARS)
     int32 MaxLevel = 100;
 
+    /*Interval of the batched statistics regeneration, regenerated amounts are scaled by the elapsed world time*/
+    UPROPERTY(EditAnywhere, config, Category = "ARS | StatRegen", meta = (ClampMin = 0.01))
+    float RegenerationInterval = 0.2f;
+
     UARSGenerationRulesDataAsset* GetAttributesGenerationRules() const
     {
         return Cast<UARSGenerationRulesDataAsset>(AttributesGenerationConfig.TryLoad());
@@ -0,0 +1,85 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ARSTypes.h"
+#include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include <GameplayTagContainer.h>
+
+#include "ARSRegenerationSubsystem.generated.h"
+
+class UARSStatisticsComponent;
+
+/**
+ * Regenerates the statistics of every UARSStatisticsComponent of the world in a single batched update.
+ * Regenerating stats are stored as a struct of arrays and advanced with world time, so time dilation and
+ * pause are respected. Only active rows are updated: a row sleeps once it is full or empty and wakes up
+ * when its stat is modified, rows waiting for their regen delay wake up when it expires.
+ */
+UCLASS()
+class ADVANCEDRPGSYSTEM_API UARSRegenerationSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    /*Adds or refreshes the rows of the regenerating statistics of component, pending regen delays are kept*/
+    void RegisterComponent(UARSStatisticsComponent* component, const TArray<FStatistic>& statistics);
+
+    void UnregisterComponent(UARSStatisticsComponent* component);
+
+    /*Called when a statistic is modified outside of regeneration*/
+    void NotifyStatModified(UARSStatisticsComponent* component, const FStatistic& statistic, bool bResetDelay);
+
+    UFUNCTION(BlueprintPure, Category = ARS)
+    int32 GetRegeneratingStatsNum() const { return Values.Num() - FreeRows.Num(); }
+
+private:
+    // One row per regenerating statistic. Rows never move, freed rows are recycled
+    TArray<TWeakObjectPtr<UARSStatisticsComponent>> Components;
+    TArray<FGameplayTag> StatTypes;
+    TArray<float> Values;
+    TArray<float> MinValues;
+    TArray<float> MaxValues;
+    TArray<float> RegenRates;
+    TArray<float> RegenDelays;
+    TArray<float> ResumeTimes;
+    TArray<uint8> RowStates;
+
+    enum ERowState : uint8 {
+        Sleeping,
+        Active,
+        Delayed,
+    };
+
+    TArray<int32> ActiveRows;
+    TArray<int32> DelayedRows;
+    TArray<int32> FreeRows;
+
+    // Values changed by the last update. Handlers may register components and reallocate the rows,
+    // so callbacks only read these copies
+    struct FRegeneratedValue {
+        TWeakObjectPtr<UARSStatisticsComponent> Component;
+        FGameplayTag StatType;
+        float Value;
+    };
+    TArray<FRegeneratedValue> RegeneratedValues;
+    TMap<TObjectKey<UARSStatisticsComponent>, TArray<int32>> ComponentRows;
+
+    FTimerHandle UpdateTimer;
+    float LastUpdateTime = 0.f;
+
+    void UpdateRegeneration();
+
+    int32 AllocateRow();
+    void FreeRow(int32 row);
+    void WriteRow(int32 row, const FStatistic& statistic);
+    void WakeRow(int32 row);
+    void SetRowState(int32 row, ERowState newState);
+    bool IsRowSaturated(int32 row) const;
+    int32 FindRow(const UARSStatisticsComponent* component, const FGameplayTag& statType) const;
+};
@@ -0,0 +1,169 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ARSTypes.h"
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include <GameplayTagContainer.h>
+
+#include "ARSReplicatedAttributeSet.generated.h"
+
+class UARSStatisticsComponent;
+
+/**
+ * Replicated mirror of the FAttributesSet of a UARSStatisticsComponent.
+ * The authoritative AttributeSet lives on the server, these arrays only mark dirty the entries
+ * that actually changed so regeneration ticks send a single quantized value per statistic.
+ */
+
+/*Statistic current value sent as a fixed point integer with a 1/100 precision*/
+USTRUCT()
+struct FARSQuantizedStatValue {
+    GENERATED_BODY()
+
+public:
+    FARSQuantizedStatValue() { }
+    FARSQuantizedStatValue(float inValue)
+        : Value(inValue)
+    {
+    }
+
+    UPROPERTY()
+    float Value = 0.f;
+
+    static int32 Quantize(float inValue) { return FMath::RoundToInt(FMath::Clamp(inValue, -1.e7f, 1.e7f) * 100.f); }
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FARSQuantizedStatValue> : public TStructOpsTypeTraitsBase2<FARSQuantizedStatValue> {
+    enum {
+        WithNetSerializer = true,
+    };
+};
+
+USTRUCT()
+struct FARSAttributeItem : public FFastArraySerializerItem {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    FAttribute Attribute;
+};
+
+/*Primary attributes or parameters*/
+USTRUCT()
+struct FARSAttributeArray : public FFastArraySerializer {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<FARSAttributeItem> Items;
+
+    UARSStatisticsComponent* Owner = nullptr;
+
+    /*Server side, adds, updates and removes items to match source, marking dirty only what changed*/
+    void Sync(const TArray<FAttribute>& source);
+
+    void CopyTo(TArray<FAttribute>& outAttributes) const;
+
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FARSAttributeItem, FARSAttributeArray>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FARSAttributeArray> : public TStructOpsTypeTraitsBase2<FARSAttributeArray> {
+    enum {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+/*Statistic definition (max, regeneration...), its CurrentValue is replicated by FARSStatisticValueArray*/
+USTRUCT()
+struct FARSStatisticItem : public FFastArraySerializerItem {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    FStatistic Statistic;
+};
+
+USTRUCT()
+struct FARSStatisticArray : public FFastArraySerializer {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<FARSStatisticItem> Items;
+
+    UARSStatisticsComponent* Owner = nullptr;
+
+    void Sync(const TArray<FStatistic>& source);
+
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FARSStatisticItem, FARSStatisticArray>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FARSStatisticArray> : public TStructOpsTypeTraitsBase2<FARSStatisticArray> {
+    enum {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+USTRUCT()
+struct FARSStatisticValueItem : public FFastArraySerializerItem {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    FGameplayTag StatType;
+
+    UPROPERTY()
+    FARSQuantizedStatValue CurrentValue;
+};
+
+USTRUCT()
+struct FARSStatisticValueArray : public FFastArraySerializer {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<FARSStatisticValueItem> Items;
+
+    UARSStatisticsComponent* Owner = nullptr;
+
+    void Sync(const TArray<FStatistic>& source);
+
+    /*Server side, marks the item dirty only if the quantized value changed*/
+    void SetValue(const FGameplayTag& statType, float value);
+
+    const FARSStatisticValueItem* FindValue(const FGameplayTag& statType) const
+    {
+        return Items.FindByPredicate([&statType](const FARSStatisticValueItem& item) { return item.StatType == statType; });
+    }
+
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FARSStatisticValueItem, FARSStatisticValueArray>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FARSStatisticValueArray> : public TStructOpsTypeTraitsBase2<FARSStatisticValueArray> {
+    enum {
+        WithNetDeltaSerializer = true,
+    };
+};
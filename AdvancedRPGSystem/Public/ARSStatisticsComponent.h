@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ARSReplicatedAttributeSet.h"
 #include "ARSTypes.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
@@ -26,6 +27,8 @@ public:
     // Sets default values for this component's properties
     UARSStatisticsComponent();
 
+    virtual void PostInitProperties() override;
+
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
@@ -75,41 +78,70 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ARS | StatRegen")
     bool bCanRegenerateStatistics = true;
 
-    /*Regeneration time interval, set high values for optimization*/
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ARS | StatRegen")
+    /*Unused, regeneration is batched by UARSRegenerationSubsystem. Not editable anymore, kept for the Blueprints that still read it*/
+    UPROPERTY(BlueprintReadWrite, Category = "ARS | StatRegen", meta = (DeprecatedProperty, DeprecationMessage = "Regeneration is batched by the ARS regeneration subsystem, set its interval in ARS Settings"))
     float RegenerationTimeInterval = 0.2f;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
     UFUNCTION()
     TArray<FAttribute> GetPrimitiveAttributesForCurrentLevel();
 
-    TMap<FGameplayTag, FDateTime> regenDelay;
-
     UPROPERTY()
     bool bIsInitialized = false;
 
     TArray<FAttributesSetModifier> storedUnactiveModifiers;
 
-    UPROPERTY()
-    FTimerHandle RegenTimer;
-
     UPROPERTY()
     bool bIsRegenerationStarted = false;
 
     TArray<FAttribute> Internal_GetPrimitiveAttributesForCurrentLevel();
 
-    void RegenerateStat();
+    class UARSRegenerationSubsystem* GetRegenerationSubsystem() const;
+
+    /*Pushes the current statistics to the regeneration subsystem if regeneration is running*/
+    void RefreshRegeneration();
+
+    void BroadcastStatisticChanged(const FStatistic& stat, float oldValue);
+
+    friend class UARSRegenerationSubsystem;
+
+    /*Called by UARSRegenerationSubsystem when a regenerating statistic changed*/
+    void ApplyRegeneratedValue(const FGameplayTag& statType, float newValue);
 
-    UPROPERTY(SaveGame, ReplicatedUsing = OnRep_AttributeSet)
+    /*Authoritative on server, rebuilt from the replicated arrays below on clients*/
+    UPROPERTY(SaveGame)
     FAttributesSet AttributeSet;
 
+    UPROPERTY(Replicated)
+    FARSAttributeArray ReplicatedAttributes;
 
+    UPROPERTY(Replicated)
+    FARSAttributeArray ReplicatedParameters;
+
+    UPROPERTY(Replicated)
+    FARSStatisticArray ReplicatedStatistics;
+
+    UPROPERTY(Replicated)
+    FARSStatisticValueArray ReplicatedStatisticValues;
+
+    friend struct FARSAttributeArray;
+    friend struct FARSStatisticArray;
+    friend struct FARSStatisticValueArray;
+
+    /*Server side, pushes the changed entries of AttributeSet to the replicated arrays*/
+    void SyncReplicatedAttributeSet();
+
+    void HandleReplicatedDefinitions();
+    void HandleReplicatedValues();
 
     UFUNCTION()
     void OnRep_AttributeSet();
 
     void Internal_InitializeStats();
 
+    /*Only relevant for the owner*/
     UPROPERTY(SaveGame, Replicated)
     FAttributesSet baseAttributeSet;
 
@@ -129,7 +161,27 @@ private:
     FAttributesSetModifier CreateAdditiveAttributeSetModifireFromPercentage(const FAttributesSetModifier& _modifier);
 
     void GenerateSecondaryStat();
-    void GenerateSecondaryStatFromCurrentPrimaryStat();
+
+    /*Adds the curve values of the primary attributes to the secondary stats, only to the dirty ones if provided.
+     Returns the number of primary attributes evaluated, the first one without rules stops the generation*/
+    int32 GenerateSecondaryStatFromCurrentPrimaryStat(const TSet<FGameplayTag>* dirtyParameters = nullptr, const TSet<FGameplayTag>* dirtyStatistics = nullptr);
+
+    /*Primary attributes and curve generated secondary stats of the last generation, before modifiers*/
+    TArray<FAttribute> CurveInputs;
+    FAttributesSet CurveOutputs;
+    int32 CurveInputsEvaluatedNum = 0;
+    bool bCurveOutputsValid = false;
+
+    /*Secondary stats read by the curves of the primary attributes changed since the last generation*/
+    TSet<FGameplayTag> DirtyCurveParameters;
+    TSet<FGameplayTag> DirtyCurveStatistics;
+
+    /*Statistics before the last generation, kept to reuse their allocation and layout*/
+    FAttributesSet PreviousStatistics;
+
+    bool HasSameCurveInputTypes() const;
+    bool CollectDirtyCurveOutputs();
+    void ResetDirtyCurveOutputs();
 
     // Regenerate Stats
     UFUNCTION(BlueprintCallable, Category = ARS)
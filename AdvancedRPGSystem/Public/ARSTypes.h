@@ -179,8 +179,8 @@ public:
 
     FORCEINLINE bool operator!=(const FStatisticsModifier& Other) const { return this->StatType != Other.AttributeType; }
 
-    FORCEINLINE bool operator<(const FStatistic& Other) const { return this->StatType.ToString() < Other.StatType.ToString(); }
-    FORCEINLINE bool operator>(const FStatistic& Other) const { return this->StatType.ToString() > Other.StatType.ToString(); }
+    FORCEINLINE bool operator<(const FStatistic& Other) const { return this->StatType < Other.StatType; }
+    FORCEINLINE bool operator>(const FStatistic& Other) const { return Other.StatType < this->StatType; }
 
 
     FORCEINLINE FStatistic operator+(const FStatistic& Other) const
@@ -320,6 +320,17 @@ struct FAttribute {
    // FORCEINLINE bool operator>(const FAttribute& Other) const { return this->AttributeType > Other.AttributeType; }
 };
 
+/*Tag to slot maps of an attribute set. Copies of a set share it until their entries change, it is freed with the last one*/
+struct ADVANCEDRPGSYSTEM_API FARSAttributeSetLayout {
+    TMap<FGameplayTag, int32> AttributeSlots;
+    TMap<FGameplayTag, int32> StatisticSlots;
+    TMap<FGameplayTag, int32> ParameterSlots;
+
+    static TSharedRef<const FARSAttributeSetLayout> Create(const TArray<FAttribute>& attributes, const TArray<FStatistic>& statistics, const TArray<FAttribute>& parameters);
+
+    bool Matches(const TArray<FAttribute>& attributes, const TArray<FStatistic>& statistics, const TArray<FAttribute>& parameters) const;
+};
+
 USTRUCT(BlueprintType)
 struct FAttributesSet : public FTableRowBase {
     GENERATED_BODY()
@@ -341,9 +352,52 @@ public:
         Attributes.Sort();
         Statistics.Sort();
         Parameters.Sort();
+        RefreshLayout();
     }
 
+    /*Rebuilds the layout if it no longer matches the slots, call after entries were added, removed or reordered*/
+    void RefreshLayout()
+    {
+        if (!Layout.IsValid() || !Layout->Matches(Attributes, Statistics, Parameters)) {
+            Layout = FARSAttributeSetLayout::Create(Attributes, Statistics, Parameters);
+        }
+    }
+
+    FAttribute* FindAttribute(const FGameplayTag& tag) { return FindSlot(Attributes, GetLayout().AttributeSlots, tag); }
+    const FAttribute* FindAttribute(const FGameplayTag& tag) const { return FindSlot(Attributes, GetLayout().AttributeSlots, tag); }
+
+    FStatistic* FindStatistic(const FGameplayTag& tag) { return FindSlot(Statistics, GetLayout().StatisticSlots, tag); }
+    const FStatistic* FindStatistic(const FGameplayTag& tag) const { return FindSlot(Statistics, GetLayout().StatisticSlots, tag); }
+
+    FAttribute* FindParameter(const FGameplayTag& tag) { return FindSlot(Parameters, GetLayout().ParameterSlots, tag); }
+    const FAttribute* FindParameter(const FGameplayTag& tag) const { return FindSlot(Parameters, GetLayout().ParameterSlots, tag); }
+
     ~FAttributesSet() {};
+
+private:
+    mutable TSharedPtr<const FARSAttributeSetLayout> Layout;
+
+    const FARSAttributeSetLayout& GetLayout() const
+    {
+        if (!Layout.IsValid()) {
+            Layout = FARSAttributeSetLayout::Create(Attributes, Statistics, Parameters);
+        }
+        return *Layout;
+    }
+
+    static const FGameplayTag& GetSlotTag(const FAttribute& attribute) { return attribute.AttributeType; }
+    static const FGameplayTag& GetSlotTag(const FStatistic& statistic) { return statistic.StatType; }
+
+    // O(1) while the layout matches, falls back to a linear search if entries were added or moved since
+    template <typename ArrayType>
+    static auto FindSlot(ArrayType& elements, const TMap<FGameplayTag, int32>& slots, const FGameplayTag& tag) -> decltype(elements.GetData())
+    {
+        const int32* slot = slots.Find(tag);
+        if (slot && elements.IsValidIndex(*slot) && GetSlotTag(elements[*slot]) == tag) {
+            return &elements[*slot];
+        }
+        return elements.FindByKey(tag);
+    }
 };
 
 USTRUCT(BlueprintType)
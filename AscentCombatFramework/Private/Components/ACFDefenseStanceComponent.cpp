@@ -150,7 +150,7 @@ bool UACFDefenseStanceComponent::CanBlockDamage(const FACFDamageEvent& damageEve
         return false;
     }
 
-    const UACFActionsManagerComponent* ownerActions = GetOwner()->FindComponentByClass<UACFActionsManagerComponent>();
+    UACFActionsManagerComponent* ownerActions = GetOwner()->FindComponentByClass<UACFActionsManagerComponent>();
     // you can't block while doing other actions
 
     if (!ownerActions || !ownerActions->CanExecuteAction(ActionToBeTriggeredOnBlock)) {
@@ -203,7 +203,7 @@ bool UACFDefenseStanceComponent::CanCounterAttack(const FACFDamageEvent& incomin
         return false;
     }
 
-    const UACFActionsManagerComponent* actionsManager = GetOwner()->FindComponentByClass<UACFActionsManagerComponent>();
+    UACFActionsManagerComponent* actionsManager = GetOwner()->FindComponentByClass<UACFActionsManagerComponent>();
     if (!actionsManager) {
         return false;
     }
@@ -38,6 +38,11 @@ void UALSLoadAndSaveComponent::LoadActor()
     }
 }
 
+void UALSLoadAndSaveComponent::MarkDirty()
+{
+    GetSaveSubsystem()->MarkActorDirty(GetOwner());
+}
+
 void UALSLoadAndSaveComponent::DispatchLoaded()
 {
     bAlreadyLoaded = true;
@@ -7,6 +7,7 @@
 #include "ALSSaveInfo.h"
 #include "Engine/GameInstance.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeLock.h"
 #include <GameFramework/Pawn.h>
 #include <Serialization/MemoryReader.h>
 #include <Serialization/MemoryWriter.h>
@@ -21,6 +22,7 @@ void UALSLoadAndSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void UALSLoadAndSaveSubsystem::Deinitialize()
 {
     FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+    FlushPendingWrites();
     currentSavegame = nullptr; 
 
 }
@@ -38,7 +40,9 @@ void UALSLoadAndSaveSubsystem::SaveGameWorld(const FString& slotName, const FOnS
     bSaveScreen = bSaveScreenshot;
     currentSavegame = LoadOrCreateSaveGame(slotName);
     systemState = ELoadingState::ESaving;
-    (new FAutoDeleteAsyncTask<FSaveWorldTask>(slotName, GetWorld(), bSaveLocalPlayer,  slotDescription))->StartBackgroundTask();
+    SavingDirtyActors = MoveTemp(DirtyActors);
+    DirtyActors.Reset();
+    (new FAutoDeleteAsyncTask<FSaveWorldTask>(slotName, GetWorld(), bSaveLocalPlayer,  slotDescription, SavingDirtyActors))->StartBackgroundTask();
 }
 
 void UALSLoadAndSaveSubsystem::SaveGameWorldInCurrentSlot(const FOnSaveFinished& saveCallback, const bool bSaveLocalPlayer /*= true*/,
@@ -92,7 +96,7 @@ bool UALSLoadAndSaveSubsystem::SaveLocalPlayer(const FString& slotName)
     FALSPlayerData newData;
     if (CreatePlayerData(newData)) {
         saveGame->StoreLocalPlayer(newData);
-        UGameplayStatics::SaveGameToSlot(saveGame, slotName, 0);
+        WriteSaveGame(saveGame, slotName);
         UGameplayStatics::SaveGameToSlot(saveInfo, saveSettings->GetSaveMetadataName(), 0);
         currentSaveSlot = slotName;
         return true;
@@ -133,6 +137,59 @@ bool UALSLoadAndSaveSubsystem::SaveActor(AActor* actorToSave)
     return false;
 }
 
+void UALSLoadAndSaveSubsystem::MarkActorDirty(AActor* actor)
+{
+    if (actor) {
+        DirtyActors.Add(actor->GetFName());
+    }
+}
+
+bool UALSLoadAndSaveSubsystem::WriteSaveGame(UALSSaveGame* saveGame, const FString& slotName)
+{
+    if (!saveGame) {
+        return false;
+    }
+
+    const UALSSaveGameSettings* saveSettings = GetMutableDefault<UALSSaveGameSettings>();
+    saveGame->PackDirtyLevels(saveSettings->GetLevelCompressionFormat());
+
+    if (!saveSettings->ShouldWriteInBackground()) {
+        return UGameplayStatics::SaveGameToSlot(saveGame, slotName, 0);
+    }
+
+    TArray<uint8> saveData;
+    if (!UGameplayStatics::SaveGameToMemory(saveGame, saveData)) {
+        return false;
+    }
+
+    FScopeLock lock(&PendingWriteLock);
+    FGraphEventArray prerequisites;
+    if (PendingWrite.IsValid()) {
+        prerequisites.Add(PendingWrite);
+    }
+    PendingWrite = FFunctionGraphTask::CreateAndDispatchWhenReady(
+        [saveData = MoveTemp(saveData), slotName]() {
+            if (!UGameplayStatics::SaveDataToSlot(saveData, slotName, 0)) {
+                UE_LOG(LogTemp, Error, TEXT("Failed to write save slot %s"), *slotName);
+            }
+        },
+        TStatId(), &prerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+    return true;
+}
+
+void UALSLoadAndSaveSubsystem::FlushPendingWrites()
+{
+    FGraphEventRef lastWrite;
+    {
+        FScopeLock lock(&PendingWriteLock);
+        lastWrite = PendingWrite;
+        PendingWrite = nullptr;
+    }
+    if (lastWrite.IsValid()) {
+        FTaskGraphInterface::Get().WaitUntilTaskCompletes(lastWrite);
+    }
+}
+
 bool UALSLoadAndSaveSubsystem::LoadActor(AActor* actorToLoad)
 {
     if (!actorToLoad) {
@@ -202,7 +259,7 @@ bool UALSLoadAndSaveSubsystem::SavePlayer(const FString& slotName, const FString
     CreateOrUpdateSlotInfo(slotName);
     currentSaveSlot = slotName;
 
-    return UGameplayStatics::SaveGameToSlot(saveGame, slotName, 0);
+    return WriteSaveGame(saveGame, slotName);
 }
 
 bool UALSLoadAndSaveSubsystem::CreateOrUpdateSlotInfo(const FString& slotName)
@@ -301,6 +358,7 @@ bool UALSLoadAndSaveSubsystem::LoadTraveledPlayer()
 
 void UALSLoadAndSaveSubsystem::DeleteSlot(const FString tempSlot)
 {
+    FlushPendingWrites();
     UGameplayStatics::DeleteGameInSlot(tempSlot, 0);
     RemoveSlotInfo(tempSlot);
 }
@@ -393,7 +451,10 @@ void UALSLoadAndSaveSubsystem::FinishSaveWork(const bool bSuccess)
     const UALSSaveGameSettings* saveSettings = GetMutableDefault<UALSSaveGameSettings>();
     if (bSuccess) {
         UALSFunctionLibrary::TrySaveScreenshot(currentSaveSlot, saveSettings->GetDefaultScreenshotWidth(), saveSettings->GetDefaultScreenshotHeight());
+    } else {
+        DirtyActors.Append(SavingDirtyActors);
     }
+    SavingDirtyActors.Reset();
     onSaveFinishedInternal.ExecuteIfBound(bSuccess);
     systemState = ELoadingState::EIdle;
 }
@@ -437,6 +498,8 @@ void UALSLoadAndSaveSubsystem::AsyncLoadSaveGame(const FString& savegameName)
     FAsyncLoadGameFromSlotDelegate LoadedDelegate;
     LoadedDelegate.BindUObject(this, &UALSLoadAndSaveSubsystem::HandleLoadCompleted);
 
+    FlushPendingWrites();
+
     UGameplayStatics::AsyncLoadGameFromSlot(savegameName, 0, LoadedDelegate);
 }
 
@@ -464,6 +527,7 @@ UALSSaveGame* UALSLoadAndSaveSubsystem::LoadOrCreateSaveGame(const FString& slot
     if (slotName == currentSaveSlot && currentSavegame) {
         return currentSavegame;
     }
+    FlushPendingWrites();
     UALSSaveGame* saveGame = Cast<UALSSaveGame>(UGameplayStatics::LoadGameFromSlot(slotName, 0));
     if (saveGame) {
         return saveGame;
@@ -26,21 +26,29 @@ void FLoadWorldTask::DoWork()
     }
 
     ToBeDestroyed.Empty();
-    FALSLevelData toBeDeserialized;
 
-    if (loadedGame->TryGetLevelData(levelName, toBeDeserialized)) {
-        TArray<FALSActorData> actorsData = toBeDeserialized.GetActorsCopy();
+    if (const FALSLevelData* toBeDeserialized = loadedGame->FindLevelData(levelName)) {
+        const TArray<FALSActorData>& actorsData = toBeDeserialized->GetActors();
 
-        ToBeSpawned = actorsData;
+        // Single pass over the live actors, records are resolved through the level's name index
+        TBitArray<> matchedRecords(false, actorsData.Num());
         for (auto& actor : LoadableActors) {
-            FALSActorData* actorData = actorsData.FindByKey(actor);
-            if (actorData) {
-                DeserializeActor(actor, *actorData);
-                ToBeSpawned.Remove(*actorData);
+            const int32 recordIndex = toBeDeserialized->FindActorRecordIndex(actor->GetFName());
+            if (recordIndex != INDEX_NONE) {
+                DeserializeActor(actor, actorsData[recordIndex]);
+                matchedRecords[recordIndex] = true;
             } else if (!UALSFunctionLibrary::IsSpecialActor(world, actor) && !IALSSavableInterface::Execute_ShouldBeIgnored(actor)) {
                 ToBeDestroyed.Add(actor);
             }
         }
+
+        ToBeSpawned.Reset(actorsData.Num());
+        for (int32 recordIndex = 0; recordIndex < actorsData.Num(); ++recordIndex) {
+            if (!matchedRecords[recordIndex]) {
+                ToBeSpawned.Add(actorsData[recordIndex]);
+            }
+        }
+
         if (bLoadAll) {
             ReloadPlayer();
         }
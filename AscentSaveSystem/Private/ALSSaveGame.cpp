@@ -12,3 +12,43 @@ void UALSSaveGame::OnLoaded_Implementation()
 {
 
 }
+
+const FALSLevelData* UALSSaveGame::FindOrUnpackLevel(const FString& levelName)
+{
+	if (const FALSLevelData* levelData = UnpackedLevels.Find(levelName)) {
+		return levelData;
+	}
+
+	FALSLevelData legacyLevel;
+	if (Levels.RemoveAndCopyValue(levelName, legacyLevel)) {
+		DirtyLevels.Add(levelName);
+		return &UnpackedLevels.Add(levelName, MoveTemp(legacyLevel));
+	}
+
+	if (const FALSLevelChunk* chunk = LevelChunks.Find(levelName)) {
+		FALSLevelData levelData;
+		if (chunk->Unpack(levelData)) {
+			return &UnpackedLevels.Add(levelName, MoveTemp(levelData));
+		}
+	}
+	return nullptr;
+}
+
+FALSLevelData& UALSSaveGame::FindOrAddDirtyLevel(const FString& levelName)
+{
+	DirtyLevels.Add(levelName);
+	if (FindOrUnpackLevel(levelName)) {
+		return UnpackedLevels.FindChecked(levelName);
+	}
+	return UnpackedLevels.Add(levelName);
+}
+
+void UALSSaveGame::PackDirtyLevels(const FName& compressionFormat)
+{
+	for (const FString& levelName : DirtyLevels) {
+		if (const FALSLevelData* levelData = UnpackedLevels.Find(levelName)) {
+			LevelChunks.FindOrAdd(levelName).Pack(*levelData, compressionFormat);
+		}
+	}
+	DirtyLevels.Reset();
+}
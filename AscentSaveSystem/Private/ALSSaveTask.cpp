@@ -20,6 +20,28 @@
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include <Async/TaskGraphInterfaces.h>
 
+FSaveWorldTask::FSaveWorldTask(const FString& slotName, UWorld* inWorld, const bool saveLocalPlayer, FString inSlotDescription, const TSet<FName>& inDirtyActors)
+{
+    saveName = slotName;
+    DirtyActors = inDirtyActors;
+    slotDesc = inSlotDescription;
+    world = inWorld;
+    bSaveLocalPlayer = saveLocalPlayer;
+    newSave = nullptr;
+    if (world) {
+        UGameplayStatics::GetAllActorsWithInterface(world, UALSSavableInterface::StaticClass(), SavableActors);
+
+        // Built on the game thread, the only one that reads or changes the levels of the save game
+        UALSLoadAndSaveSubsystem* saveSusbsystem = UGameplayStatics::GetGameInstance(world)->GetSubsystem<UALSLoadAndSaveSubsystem>();
+        newSave = saveSusbsystem->GetOrCreateCurrentSaveGame(); // Cast<UALSSaveGame>(UGameplayStatics::CreateSaveGameObject(saveClass));
+        result.LevelName = UGameplayStatics::GetCurrentLevelName(world, true);
+        if (newSave) {
+            newSave->TryGetLevelData(result.LevelName, result.LevelRecord);
+        }
+    }
+    SuccessfullySavedActors.Empty();
+}
+
 void FSaveWorldTask::DoWork()
 {
     if (!world) {
@@ -32,23 +54,19 @@ void FSaveWorldTask::DoWork()
         FinishSave(false);
         return;
     }
-    UALSLoadAndSaveSubsystem* saveSusbsystem = UGameplayStatics::GetGameInstance(world)->GetSubsystem<UALSLoadAndSaveSubsystem>();
 
     const TSubclassOf<UALSSaveGame> saveClass = saveSettings->GetSaveGameClass();
     if (!saveClass) {
         FinishSave(false);
         return;
     }
-    newSave = saveSusbsystem->GetOrCreateCurrentSaveGame(); // Cast<UALSSaveGame>(UGameplayStatics::CreateSaveGameObject(saveClass));
 
     if (!newSave) {
         FinishSave(false);
         return;
     }
-    FALSLevelData currentLevel;
-    const FString levelName = UGameplayStatics::GetCurrentLevelName(world, true);
 
-    const bool bAlreadyAdded = newSave->TryGetLevelData(levelName, currentLevel);
+    const bool bIncremental = saveSettings->IsIncrementalSave();
 
     for (const auto& actor : SavableActors) {
         if (!actor) {
@@ -60,37 +78,58 @@ void FSaveWorldTask::DoWork()
         if (UALSFunctionLibrary::IsSpecialActor(world, actor)) {
             continue;
         }
+        // Unchanged actors keep the record of the previous save
+        if (bIncremental && !DirtyActors.Contains(actor->GetFName()) && result.LevelRecord.HasActor(actor)) {
+            continue;
+        }
         FALSActorData actorData = SerializeActor(actor);
-        currentLevel.AddActorRecord(actorData);
+        result.LevelRecord.AddActorRecord(actorData);
+    }
+
+    StoreLocalPlayer();
+
+    FinishSave(true);
+}
+
+bool FSaveWorldTask::PublishSave(UWorld* inWorld, UALSSaveGame* saveGame, const FString& slotName, const FString& slotDescription, FALSSaveTaskResult& result)
+{
+    check(IsInGameThread());
+
+    if (!inWorld || !saveGame) {
+        return false;
     }
+
+    const UALSSaveGameSettings* saveSettings = GetMutableDefault<UALSSaveGameSettings>();
+    UALSLoadAndSaveSubsystem* saveSusbsystem = UGameplayStatics::GetGameInstance(inWorld)->GetSubsystem<UALSLoadAndSaveSubsystem>();
     UALSSaveInfo* saveInfo = saveSusbsystem->LoadOrCreateSaveInfo();
     if (!saveInfo) {
-        FinishSave(false);
+        return false;
+    }
+
+    // Marks the level dirty, so its chunk is packed again by WriteSaveGame
+    saveGame->FindOrAddLevelData(result.LevelName) = MoveTemp(result.LevelRecord);
+    if (result.bHasLocalPlayer) {
+        saveGame->StoreLocalPlayer(result.LocalPlayer);
     }
 
     const FTimespan SessionDuration = FDateTime::Now() - saveSusbsystem->GetStartPlayTime();
 
     FALSSaveMetadata saveMetaData;
-    saveMetaData.MapToLoad = levelName;
+    saveMetaData.MapToLoad = result.LevelName;
     saveMetaData.Data = FDateTime::Now();
-    saveMetaData.SaveName = saveName;
-    saveMetaData.SaveDescription = slotDesc;
-    saveMetaData.PlayTime = newSave->GetPlayTime() + SessionDuration.GetTotalSeconds();
+    saveMetaData.SaveName = slotName;
+    saveMetaData.SaveDescription = slotDescription;
+    saveMetaData.PlayTime = saveGame->GetPlayTime() + SessionDuration.GetTotalSeconds();
     saveInfo->AddSlot(saveMetaData);
 
-    newSave->SetPlayTime(saveMetaData.PlayTime);
+    saveGame->SetPlayTime(saveMetaData.PlayTime);
     saveSusbsystem->StartPlaytimeTracking();
 
-    newSave->AddLevel(saveMetaData.MapToLoad, currentLevel);
-
-    StoreLocalPlayer();
-
-    newSave->OnSaved();
-    UGameplayStatics::SaveGameToSlot(newSave, saveName, 0);
+    saveGame->OnSaved();
+    saveSusbsystem->WriteSaveGame(saveGame, slotName);
 
     UGameplayStatics::SaveGameToSlot(saveInfo, saveSettings->GetSaveMetadataName(), 0);
-
-    FinishSave(true);
+    return true;
 }
 
 FALSActorData FSaveWorldTask::SerializeActor(AActor* actor)
@@ -103,14 +142,16 @@ FALSActorData FSaveWorldTask::SerializeActor(AActor* actor)
 void FSaveWorldTask::FinishSave(const bool bSuccess)
 {
     if (IsInGameThread()) {
-        UGameplayStatics::GetGameInstance(this->world)->GetSubsystem<UALSLoadAndSaveSubsystem>()->FinishSaveWork(bSuccess);
+        const bool bPublished = bSuccess && PublishSave(world, newSave, saveName, slotDesc, result);
+        UGameplayStatics::GetGameInstance(this->world)->GetSubsystem<UALSLoadAndSaveSubsystem>()->FinishSaveWork(bPublished);
     } else {
-        FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-            FSimpleDelegateGraphTask::FDelegate::CreateStatic(
-                &GFinishSave, world,
-                bSuccess),
-            GetStatId(),
-            nullptr, ENamedThreads::GameThread);
+        // The task is deleted once DoWork returns, its records are moved to the game thread
+        FFunctionGraphTask::CreateAndDispatchWhenReady(
+            [inWorld = world, saveGame = newSave, slotName = saveName, slotDescription = slotDesc, taskResult = MoveTemp(result), bSuccess]() mutable {
+                const bool bPublished = bSuccess && PublishSave(inWorld, saveGame, slotName, slotDescription, taskResult);
+                GFinishSave(inWorld, bPublished);
+            },
+            GetStatId(), nullptr, ENamedThreads::GameThread);
     }
 }
 
@@ -121,8 +162,8 @@ void FSaveWorldTask::StoreLocalPlayer()
     if (UALSFunctionLibrary::ShouldSaveActor(playerCont) && UALSFunctionLibrary::ShouldSaveActor(pawn)) {
         const FALSActorData pcData = SerializeActor(playerCont);
         const FALSActorData pawnData = SerializeActor(pawn);
-        FALSPlayerData playerData(pcData, pawnData);
-        newSave->StoreLocalPlayer(playerData);
+        result.LocalPlayer = FALSPlayerData(pcData, pawnData);
+        result.bHasLocalPlayer = true;
     } else {
         UE_LOG(LogTemp, Error,
             TEXT("Player Controller or Pawn does not implement savable interface! - FSaveWorldTask::StoreLocalPlayer"));
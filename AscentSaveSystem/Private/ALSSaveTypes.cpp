@@ -2,6 +2,9 @@
 
 
 #include "ALSSaveTypes.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 
@@ -51,7 +54,97 @@ bool FALSLevelData::Serialize(FArchive& Ar)
 	Super::Serialize(Ar);
 
 	Ar << Actors;
+	return true;
+}
+
+/* The only place where the indices are rebuilt, called by the struct serialization (FALSLevelChunk::Unpack included) */
+void FALSLevelData::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading()) {
+		RebuildIndex(Actors, ActorIndex);
+		RebuildIndex(WPActors, WPActorIndex);
+	}
+}
+
+void FALSLevelData::AddOrReplaceRecord(TArray<FALSActorData>& records, TMap<FName, int32>& index, const FALSActorData& actorData)
+{
+	if (const int32* foundIndex = index.Find(actorData.GetName())) {
+		records[*foundIndex] = actorData;
+		return;
+	}
+	index.Add(actorData.GetName(), records.Add(actorData));
+}
+
+const FALSActorData* FALSLevelData::FindRecord(const TArray<FALSActorData>& records, const TMap<FName, int32>& index, const FName& actorName)
+{
+	const int32* foundIndex = index.Find(actorName);
+	return foundIndex ? &records[*foundIndex] : nullptr;
+}
+
+void FALSLevelData::RebuildIndex(TArray<FALSActorData>& records, TMap<FName, int32>& index)
+{
+	index.Reset();
+	index.Reserve(records.Num());
 
+	// Older saves may hold duplicated names, the latest record wins
+	int32 writeIndex = 0;
+	for (int32 readIndex = 0; readIndex < records.Num(); ++readIndex) {
+		const FName actorName = records[readIndex].GetName();
+		if (const int32* foundIndex = index.Find(actorName)) {
+			records[*foundIndex] = MoveTemp(records[readIndex]);
+			continue;
+		}
+		if (writeIndex != readIndex) {
+			records[writeIndex] = MoveTemp(records[readIndex]);
+		}
+		index.Add(actorName, writeIndex++);
+	}
+	records.SetNum(writeIndex, EAllowShrinking::No);
+}
+
+
+
+bool FALSLevelChunk::Pack(const FALSLevelData& levelData, const FName& inCompressionFormat)
+{
+	TArray<uint8> rawData;
+	FMemoryWriter MemoryWriter(rawData, true);
+	FALSSaveGameArchive Archive(MemoryWriter, false);
+	FALSLevelData::StaticStruct()->SerializeItem(Archive, const_cast<FALSLevelData*>(&levelData), nullptr);
+
+	UncompressedSize = rawData.Num();
+
+	if (!inCompressionFormat.IsNone() && FCompression::IsFormatValid(inCompressionFormat)) {
+		int32 compressedSize = FCompression::CompressMemoryBound(inCompressionFormat, UncompressedSize);
+		Data.SetNumUninitialized(compressedSize);
+		if (FCompression::CompressMemory(inCompressionFormat, Data.GetData(), compressedSize, rawData.GetData(), UncompressedSize)) {
+			Data.SetNum(compressedSize);
+			CompressionFormat = inCompressionFormat;
+			return true;
+		}
+		UE_LOG(LogTemp, Warning, TEXT("Failed to compress level %s, storing it uncompressed"), *levelData.GetName().ToString());
+	}
+
+	Data = MoveTemp(rawData);
+	CompressionFormat = NAME_None;
 	return true;
 }
 
+bool FALSLevelChunk::Unpack(FALSLevelData& outLevelData) const
+{
+	TArray<uint8> uncompressedData;
+	const TArray<uint8>* rawData = &Data;
+
+	if (!CompressionFormat.IsNone()) {
+		uncompressedData.SetNumUninitialized(UncompressedSize);
+		if (!FCompression::UncompressMemory(CompressionFormat, uncompressedData.GetData(), UncompressedSize, Data.GetData(), Data.Num())) {
+			UE_LOG(LogTemp, Error, TEXT("Failed to uncompress level chunk (%s)"), *CompressionFormat.ToString());
+			return false;
+		}
+		rawData = &uncompressedData;
+	}
+
+	FMemoryReader MemoryReader(*rawData, true);
+	FALSSaveGameArchive Archive(MemoryReader, false);
+	FALSLevelData::StaticStruct()->SerializeItem(Archive, &outLevelData, nullptr);
+	return !Archive.IsError();
+}
@@ -46,6 +46,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = ALS)
     void LoadActor();
 
+    /**
+     * Flags the owning actor as changed, so the next incremental save serializes it again.
+     * This function can be called from Blueprints.
+     */
+    UFUNCTION(BlueprintCallable, Category = ALS)
+    void MarkDirty();
+
     /**
      * Event triggered when the actor is successfully saved.
      */
@@ -9,8 +9,10 @@
 #include "ALSSaveGameSettings.h"
 #include "ALSSaveInfo.h"
 #include "ALSSaveTask.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
+#include "HAL/CriticalSection.h"
 #include "Kismet/GameplayStatics.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include <Async/AsyncWork.h>
@@ -166,6 +168,33 @@ public:
     UFUNCTION(BlueprintCallable, Category = ALS)
     bool SaveActor(AActor* actorToSave);
 
+    /**
+     * Marks the actor as changed since the last save.
+     *
+     * With incremental saves enabled, only dirty actors (and actors without a record) are serialized again.
+     *
+     * @param actor The actor whose state changed.
+     */
+    UFUNCTION(BlueprintCallable, Category = ALS)
+    void MarkActorDirty(AActor* actor);
+
+    /**
+     * Packs the dirty levels of the save game and writes it to the specified slot.
+     *
+     * When background writes are enabled the slot is serialized to memory here and written to disk
+     * on a worker thread, writes are executed in the order they were issued.
+     *
+     * @param saveGame The save game to write.
+     * @param slotName The name of the slot.
+     * @return True if the save was written or queued, false otherwise.
+     */
+    bool WriteSaveGame(class UALSSaveGame* saveGame, const FString& slotName);
+
+    /**
+     * Blocks until every queued background write has reached the disk.
+     */
+    void FlushPendingWrites();
+
     /**
      * Loads the specified actor.
      *
@@ -514,6 +543,16 @@ private:
     UPROPERTY()
     FALSPlayerData TravelingPlayer;
 
+    // Actors changed since the last save, by name
+    TSet<FName> DirtyActors;
+
+    // Dirty actors handed to the running save task, restored if the save fails
+    TSet<FName> SavingDirtyActors;
+
+    // Last queued background write, later writes wait on it
+    FGraphEventRef PendingWrite;
+    FCriticalSection PendingWriteLock;
+
     bool CreatePlayerData(FALSPlayerData& outData);
     bool RestorePlayerData(const FALSPlayerData& inData, bool bReloadTransform);
 };
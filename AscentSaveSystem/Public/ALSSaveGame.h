@@ -16,9 +16,24 @@ class ASCENTSAVESYSTEM_API UALSSaveGame : public USaveGame {
     GENERATED_BODY()
 
 private:
+    // Levels of saves written before chunking, moved to UnpackedLevels on first access
     UPROPERTY(SaveGame)
     TMap<FString, FALSLevelData> Levels;
 
+    // One independently packed chunk per level
+    UPROPERTY(SaveGame)
+    TMap<FString, FALSLevelChunk> LevelChunks;
+
+    // Levels unpacked since this slot was loaded
+    UPROPERTY(Transient)
+    TMap<FString, FALSLevelData> UnpackedLevels;
+
+    // Levels modified since they were last packed
+    TSet<FString> DirtyLevels;
+
+    const FALSLevelData* FindOrUnpackLevel(const FString& levelName);
+    FALSLevelData& FindOrAddDirtyLevel(const FString& levelName);
+
     UPROPERTY(SaveGame)
     TMap<FString, FALSPlayerData> Players;
 
@@ -49,22 +64,16 @@ public:
     // Stores a waypoint actor data for a given level
     void StoreWPActors(const FString& levelName, const FALSActorData& actorData)
     {
-        FALSLevelData* levelData = Levels.Find(levelName);
-        if (levelData) {
-            levelData->AddWPActorRecord(actorData);
-        } else {
-            FALSLevelData newLevelData;
-            newLevelData.AddWPActorRecord(actorData);
-            Levels.Add(levelName, newLevelData);
-        }
+        FindOrAddDirtyLevel(levelName).AddWPActorRecord(actorData);
     }
 
     // Retrieves stored waypoint actor data for a given level and actor
     bool TryGetStoredWPActor(const FString& levelName, AActor* actor, FALSActorData& outData)
     {
-        FALSLevelData* levelData = Levels.Find(levelName);
-        if (levelData && levelData->HasWPActor(actor)) {
-            outData = *(levelData->GetWPActorData(actor));
+        const FALSLevelData* levelData = FindOrUnpackLevel(levelName);
+        const FALSActorData* actorData = levelData ? levelData->GetWPActorData(actor) : nullptr;
+        if (actorData) {
+            outData = *actorData;
             return true;
         }
         return false;
@@ -101,19 +110,34 @@ public:
     // Retrieves level data if it exists
     bool TryGetLevelData(const FString& levelName, FALSLevelData& outData)
     {
-        if (const FALSLevelData* foundData = Levels.Find(levelName)) {
+        if (const FALSLevelData* foundData = FindOrUnpackLevel(levelName)) {
             outData = *foundData;
             return true;
         }
         return false;
     }
 
+    // Returns the stored level data without copying it, nullptr if the level was never saved
+    const FALSLevelData* FindLevelData(const FString& levelName)
+    {
+        return FindOrUnpackLevel(levelName);
+    }
+
+    // Returns the stored level data for in-place updates, adding an empty one if missing
+    FALSLevelData& FindOrAddLevelData(const FString& levelName)
+    {
+        return FindOrAddDirtyLevel(levelName);
+    }
+
     // Adds a new level and stores its data
     void AddLevel(const FString& levelName, const FALSLevelData& levelData)
     {
-        Levels.Add(levelName, levelData);
+        FindOrAddDirtyLevel(levelName) = levelData;
     }
 
+    // Packs every level modified since the last write into its chunk, only those chunks are re-encoded
+    void PackDirtyLevels(const FName& compressionFormat);
+
     // Called before saving this slot
     UFUNCTION(BlueprintNativeEvent, Category = ALS)
     void OnSaved();
@@ -46,6 +46,19 @@ protected:
     UPROPERTY(EditAnywhere, config, Category = "ALS | Screenshot")
     int32 MaxSlotsNum = 8;
 
+    /*Only actors marked dirty or never saved are serialized again, the others keep the record of the previous save.
+    Actors must call MarkActorDirty on the subsystem (or MarkDirty on their ALSLoadAndSaveComponent) when their state changes*/
+    UPROPERTY(EditAnywhere, config, Category = "ALS | Performance")
+    bool bIncrementalSave = false;
+
+    /*Compression applied to each level chunk, None to store them uncompressed*/
+    UPROPERTY(EditAnywhere, config, Category = "ALS | Performance")
+    FName LevelCompressionFormat = NAME_Oodle;
+
+    /*Writes the finished save buffer to disk on a background thread*/
+    UPROPERTY(EditAnywhere, config, Category = "ALS | Performance")
+    bool bWriteInBackground = true;
+
 public:
     TSubclassOf<class UALSSaveGame> GetSaveGameClass() const
     {
@@ -82,6 +95,21 @@ public:
         return MaxSlotsNum;
     }
 
+    bool IsIncrementalSave() const
+    {
+        return bIncrementalSave;
+    }
+
+    FName GetLevelCompressionFormat() const
+    {
+        return LevelCompressionFormat;
+    }
+
+    bool ShouldWriteInBackground() const
+    {
+        return bWriteInBackground;
+    }
+
     FName GetOnComponentSavedFunctionName() const
     {
         return OnComponentSavedFunctionName;
@@ -18,6 +18,14 @@
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSaveFinished, const bool, Success);
 
 
+/* Records built by a FSaveWorldTask, published to the save game on the game thread */
+struct FALSSaveTaskResult {
+	FString LevelName;
+	FALSLevelData LevelRecord;
+	FALSPlayerData LocalPlayer;
+	bool bHasLocalPlayer = false;
+};
+
 class FSaveWorldTask : public FNonAbandonableTask {
 
 public:
@@ -26,17 +34,7 @@ public:
 	FString saveName;
 	bool bSaveLocalPlayer;
 	UWorld* world;
-        explicit FSaveWorldTask(const FString& slotName, UWorld* inWorld, const bool saveLocalPlayer, FString inSlotDescription = "")
-        {
-		saveName = slotName;
-		slotDesc = inSlotDescription;
-		world = inWorld;
-		bSaveLocalPlayer = saveLocalPlayer;
-		if (world) {
-			 UGameplayStatics::GetAllActorsWithInterface(world, UALSSavableInterface::StaticClass(), SavableActors);
-		}
-		SuccessfullySavedActors.Empty();
-	}
+	explicit FSaveWorldTask(const FString& slotName, UWorld* inWorld, const bool saveLocalPlayer, FString inSlotDescription = "", const TSet<FName>& inDirtyActors = TSet<FName>());
 
 	void DoWork();
 
@@ -47,9 +45,17 @@ private:
 
 	void StoreLocalPlayer();
 
+	static bool PublishSave(UWorld* inWorld, class UALSSaveGame* saveGame, const FString& slotName, const FString& slotDescription, FALSSaveTaskResult& result);
+
 	TArray<AActor*> SavableActors;
 	TArray<AActor*> SuccessfullySavedActors;
 
+	// Snapshot of the actors marked dirty when the save started
+	TSet<FName> DirtyActors;
+
+	// Starts from a copy of the level's previous record, the task never touches the levels of the save game
+	FALSSaveTaskResult result;
+
 protected:
 	UPROPERTY(BlueprintReadOnly, Category = ALS)
 	class UALSSaveGame* newSave;
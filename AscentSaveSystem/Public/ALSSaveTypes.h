@@ -244,13 +244,20 @@ protected:
     UPROPERTY(SaveGame)
     TArray<FALSActorData> WPActors;
 
+private:
+    /** Actor name to position in Actors/WPActors. Records are only ever appended or overwritten in place,
+     * so positions stay stable. Not serialized, rebuilt in PostSerialize. */
+    TMap<FName, int32> ActorIndex;
+    TMap<FName, int32> WPActorIndex;
+
+    static void AddOrReplaceRecord(TArray<FALSActorData>& records, TMap<FName, int32>& index, const FALSActorData& actorData);
+    static const FALSActorData* FindRecord(const TArray<FALSActorData>& records, const TMap<FName, int32>& index, const FName& actorName);
+    static void RebuildIndex(TArray<FALSActorData>& records, TMap<FName, int32>& index);
+
 public:
     void AddActorRecord(const FALSActorData& actorData)
     {
-        if (Actors.Contains(actorData)) {
-            Actors.Remove(actorData);
-        }
-        Actors.AddUnique(actorData);
+        AddOrReplaceRecord(Actors, ActorIndex, actorData);
     }
 
     TArray<FALSActorData> GetActorsCopy() const
@@ -258,6 +265,18 @@ public:
         return Actors;
     }
 
+    const TArray<FALSActorData>& GetActors() const
+    {
+        return Actors;
+    }
+
+    /** Position of the actor's record in GetActors(), INDEX_NONE if it was not saved */
+    int32 FindActorRecordIndex(const FName& actorName) const
+    {
+        const FALSActorData* record = FindRecord(Actors, ActorIndex, actorName);
+        return record ? static_cast<int32>(record - Actors.GetData()) : INDEX_NONE;
+    }
+
     void GetWPActors(TArray<FALSActorData>& outActors) const
     {
         outActors = WPActors;
@@ -265,30 +284,27 @@ public:
 
     const FALSActorData* GetActorData(const AActor* actor) const
     {
-        return Actors.FindByKey(actor);
+        return actor ? FindRecord(Actors, ActorIndex, actor->GetFName()) : nullptr;
     }
 
     bool HasActor(const AActor* actor) const
     {
-        return Actors.Contains(actor);
+        return GetActorData(actor) != nullptr;
     }
 
     bool HasWPActor(const AActor* actor) const
     {
-        return WPActors.Contains(actor);
+        return GetWPActorData(actor) != nullptr;
     }
 
     void AddWPActorRecord(const FALSActorData& actorData)
     {
-        if (WPActors.Contains(actorData)) {
-            WPActors.Remove(actorData);
-        }
-        WPActors.AddUnique(actorData);
+        AddOrReplaceRecord(WPActors, WPActorIndex, actorData);
     }
 
     const FALSActorData* GetWPActorData(const AActor* actor) const
     {
-        return WPActors.FindByKey(actor);
+        return actor ? FindRecord(WPActors, WPActorIndex, actor->GetFName()) : nullptr;
     }
 
     FALSLevelData() { };
@@ -297,10 +313,40 @@ public:
     {
     }
     virtual bool Serialize(FArchive& Ar) override;
+    void PostSerialize(const FArchive& Ar);
 
     bool IsValid() const { return !alsName.IsNone(); }
 };
 
+template <>
+struct TStructOpsTypeTraits<FALSLevelData> : public TStructOpsTypeTraitsBase2<FALSLevelData> {
+    enum {
+        WithPostSerialize = true,
+    };
+};
+
+/** A level serialized on its own, so it can be packed and unpacked without touching the other levels of the slot */
+USTRUCT()
+struct FALSLevelChunk {
+    GENERATED_BODY()
+
+public:
+    /** NAME_None when Data is stored uncompressed */
+    UPROPERTY(SaveGame)
+    FName CompressionFormat;
+
+    UPROPERTY(SaveGame)
+    int32 UncompressedSize = 0;
+
+    UPROPERTY(SaveGame)
+    TArray<uint8> Data;
+
+    FALSLevelChunk() { };
+
+    bool Pack(const FALSLevelData& levelData, const FName& inCompressionFormat);
+    bool Unpack(FALSLevelData& outLevelData) const;
+};
+
 USTRUCT()
 struct FALSActorLoaded {
     GENERATED_BODY()
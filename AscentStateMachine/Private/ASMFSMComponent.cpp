@@ -2,14 +2,14 @@
 
 #include "ASMFSMComponent.h"
 #include "ASMBaseFSMState.h"
+#include "ASMFSMUpdateSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
 // Sets default values for this component's properties
 UASMFSMComponent::UASMFSMComponent()
 {
-    // Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-    // off to improve performance if you don't need them.
-    PrimaryComponentTick.bCanEverTick = true;
+    // Updated in batch by UASMFSMUpdateSubsystem
+    PrimaryComponentTick.bCanEverTick = false;
     SetIsReplicatedByDefault(true);
 }
 
@@ -20,6 +20,11 @@ void UASMFSMComponent::BeginPlay()
 //     if (StateMachine) {
 //         FSM = DuplicateObject<UASMStateMachine>(StateMachine, GetOuter());
 //     }
+    if (StateMachine) {
+        stateChangedHandle = StateMachine->OnCurrentStateChanged.AddUObject(this, &UASMFSMComponent::HandleCurrentStateChanged);
+    }
+    // The FSM could have been started before BeginPlay
+    HandleCurrentStateChanged();
 }
 
 void UASMFSMComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -27,8 +32,12 @@ void UASMFSMComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 
     if (StateMachine) {
+        StateMachine->OnCurrentStateChanged.Remove(stateChangedHandle);
         StateMachine->StopFSM();
     }
+    if (UASMFSMUpdateSubsystem* updateSubsystem = GetUpdateSubsystem()) {
+        updateSubsystem->RemoveComponent(this);
+    }
 }
 
 // void UASMFSMComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty >& OutLifetimeProps) const
@@ -37,24 +46,50 @@ void UASMFSMComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 //
 // }
 
-void UASMFSMComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UASMFSMComponent::UpdateFSM(float deltaTime)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
     if (StateMachine && StateMachine->IsActive()) {
-        StateMachine->DispatchTick(DeltaTime);
-        if (pendingTransition != FGameplayTag()) {
-            StateMachine->TriggerTransition(pendingTransition);
-            pendingTransition = FGameplayTag();
-        }
+        StateMachine->DispatchTick(deltaTime);
+    }
+}
+
+void UASMFSMComponent::ResolvePendingTransition()
+{
+    // Kept until the FSM is started, like it used to be when resolved on tick
+    if (StateMachine && StateMachine->IsActive() && pendingTransition != FGameplayTag()) {
+        const FGameplayTag transition = pendingTransition;
+        pendingTransition = FGameplayTag();
+        StateMachine->TriggerTransition(transition);
+    }
+}
+
+int32 UASMFSMComponent::GetDesiredUpdateBucket() const
+{
+    const UASMBaseFSMState* state = IsFSMActive() ? StateMachine->GetCurrentState() : nullptr;
+    if (!state || state->GetUpdateRate() == EFSMStateUpdateRate::ENone) {
+        return INDEX_NONE;
     }
+    return static_cast<int32>(state->GetUpdateRate());
 }
 
-void UASMFSMComponent::PostInitProperties()
+UASMFSMUpdateSubsystem* UASMFSMComponent::GetUpdateSubsystem() const
 {
-    Super::PostInitProperties();
+    const UWorld* world = GetWorld();
+    return world ? world->GetSubsystem<UASMFSMUpdateSubsystem>() : nullptr;
+}
 
-    SetComponentTickEnabled(true);
+void UASMFSMComponent::HandleCurrentStateChanged()
+{
+    if (!HasBegunPlay()) {
+        return;
+    }
+
+    if (UASMFSMUpdateSubsystem* updateSubsystem = GetUpdateSubsystem()) {
+        updateSubsystem->MarkUpdateRateDirty(this);
+        if (pendingTransition != FGameplayTag()) {
+            updateSubsystem->QueuePendingTransition(this);
+        }
+    }
 }
 
 void UASMFSMComponent::StartFSM()
@@ -78,6 +113,9 @@ void UASMFSMComponent::StopFSM()
 void UASMFSMComponent::TriggerTransition(const FGameplayTag& transition)
 {
     pendingTransition = transition;
+    if (UASMFSMUpdateSubsystem* updateSubsystem = GetUpdateSubsystem()) {
+        updateSubsystem->QueuePendingTransition(this);
+    }
 }
 
 void UASMFSMComponent::ClientTriggerTransition_Implementation(const FGameplayTag& transition)
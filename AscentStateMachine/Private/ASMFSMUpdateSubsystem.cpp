@@ -0,0 +1,179 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ASMFSMUpdateSubsystem.h"
+#include "ASMFSMComponent.h"
+
+void UASMFSMUpdateSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Buckets[static_cast<int32>(EFSMStateUpdateRate::EEveryFrame)].Interval = 0.f;
+    Buckets[static_cast<int32>(EFSMStateUpdateRate::EHigh)].Interval = 0.1f;
+    Buckets[static_cast<int32>(EFSMStateUpdateRate::ELow)].Interval = 0.5f;
+}
+
+void UASMFSMUpdateSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    RefreshDirtyComponents();
+
+    for (FUpdateBucket& bucket : Buckets) {
+        bucket.ElapsedTime += DeltaTime;
+        if (bucket.ElapsedTime < bucket.Interval) {
+            continue;
+        }
+
+        // States in the bucket get all the time elapsed since its last update
+        const float bucketDeltaTime = bucket.ElapsedTime;
+        bucket.ElapsedTime = 0.f;
+        UpdateBucket(bucket, bucketDeltaTime);
+
+        ResolvePendingTransitions();
+    }
+
+    // Transitions triggered by events on FSMs that are not updated this frame
+    ResolvePendingTransitions();
+
+    // Bucket changes are only applied once every bucket was updated, otherwise a component whose
+    // state changed bucket would be updated twice this frame
+    RefreshDirtyComponents();
+}
+
+TStatId UASMFSMUpdateSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UASMFSMUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UASMFSMUpdateSubsystem::Deinitialize()
+{
+    for (FUpdateBucket& bucket : Buckets) {
+        for (UASMFSMComponent* component : bucket.Components) {
+            if (component) {
+                component->UpdateBucket = INDEX_NONE;
+                component->UpdateSlot = INDEX_NONE;
+            }
+        }
+        bucket.Components.Empty();
+        bucket.NumRemoved = 0;
+    }
+    DirtyComponents.Empty();
+    PendingTransitions.Empty();
+
+    Super::Deinitialize();
+}
+
+void UASMFSMUpdateSubsystem::MarkUpdateRateDirty(UASMFSMComponent* component)
+{
+    if (component && !component->bUpdateRateDirty) {
+        component->bUpdateRateDirty = true;
+        DirtyComponents.Add(component);
+    }
+}
+
+void UASMFSMUpdateSubsystem::QueuePendingTransition(UASMFSMComponent* component)
+{
+    if (component && !component->bTransitionQueued) {
+        component->bTransitionQueued = true;
+        PendingTransitions.Add(component);
+    }
+}
+
+void UASMFSMUpdateSubsystem::RemoveComponent(UASMFSMComponent* component)
+{
+    RemoveFromBucket(component);
+
+    if (component->bUpdateRateDirty) {
+        DirtyComponents.RemoveSingleSwap(component, EAllowShrinking::No);
+        component->bUpdateRateDirty = false;
+    }
+    if (component->bTransitionQueued) {
+        PendingTransitions.RemoveSingleSwap(component, EAllowShrinking::No);
+        component->bTransitionQueued = false;
+    }
+}
+
+int32 UASMFSMUpdateSubsystem::GetUpdatedComponentsNum() const
+{
+    int32 num = 0;
+    for (const FUpdateBucket& bucket : Buckets) {
+        num += bucket.Components.Num() - bucket.NumRemoved;
+    }
+    return num;
+}
+
+bool UASMFSMUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UASMFSMUpdateSubsystem::UpdateBucket(FUpdateBucket& bucket, float deltaTime)
+{
+    // Components added while updating wait for the next update of the bucket
+    const int32 num = bucket.Components.Num();
+    for (int32 index = 0; index < num; ++index) {
+        if (UASMFSMComponent* component = bucket.Components[index]) {
+            component->UpdateFSM(deltaTime);
+        }
+    }
+
+    CompactBucket(bucket);
+}
+
+void UASMFSMUpdateSubsystem::CompactBucket(FUpdateBucket& bucket)
+{
+    if (bucket.NumRemoved == 0) {
+        return;
+    }
+
+    bucket.Components.RemoveAll([](const UASMFSMComponent* component) { return component == nullptr; });
+    for (int32 index = 0; index < bucket.Components.Num(); ++index) {
+        bucket.Components[index]->UpdateSlot = index;
+    }
+    bucket.NumRemoved = 0;
+}
+
+void UASMFSMUpdateSubsystem::ResolvePendingTransitions()
+{
+    // Resolving a transition can trigger new ones, they are appended and resolved in this same batch
+    for (int32 index = 0; index < PendingTransitions.Num(); ++index) {
+        UASMFSMComponent* component = PendingTransitions[index];
+        component->bTransitionQueued = false;
+        component->ResolvePendingTransition();
+    }
+    PendingTransitions.Reset();
+}
+
+void UASMFSMUpdateSubsystem::RefreshDirtyComponents()
+{
+    for (UASMFSMComponent* component : DirtyComponents) {
+        component->bUpdateRateDirty = false;
+
+        const int32 desiredBucket = component->GetDesiredUpdateBucket();
+        if (desiredBucket == component->UpdateBucket) {
+            continue;
+        }
+
+        RemoveFromBucket(component);
+        if (desiredBucket != INDEX_NONE) {
+            component->UpdateBucket = desiredBucket;
+            component->UpdateSlot = Buckets[desiredBucket].Components.Add(component);
+        }
+    }
+    DirtyComponents.Reset();
+}
+
+void UASMFSMUpdateSubsystem::RemoveFromBucket(UASMFSMComponent* component)
+{
+    if (component->UpdateBucket == INDEX_NONE) {
+        return;
+    }
+
+    // Slots are only compacted after an update, so this is safe while a bucket is being updated
+    FUpdateBucket& bucket = Buckets[component->UpdateBucket];
+    bucket.Components[component->UpdateSlot] = nullptr;
+    bucket.NumRemoved++;
+
+    component->UpdateBucket = INDEX_NONE;
+    component->UpdateSlot = INDEX_NONE;
+}
@@ -11,7 +11,9 @@ bool UASMStateMachine::ActivateNode(class UAGSGraphNode* node)
 {
     currentState = Cast<UASMStateNode>(node);
 
-    return Super::ActivateNode(node);
+    const bool bActivated = Super::ActivateNode(node);
+    OnCurrentStateChanged.Broadcast();
+    return bActivated;
 }
 
 void UASMStateMachine::DispatchTick(float DeltaTime)
@@ -97,6 +99,7 @@ void UASMStateMachine::StopFSM()
             DeactivateNode(node);
         }
         Enabled = EFSMState::NotStarted;
+        OnCurrentStateChanged.Broadcast();
     } else {
         UE_LOG(LogTemp, Error, TEXT("FSM Not Started - UASMStateMachine::StopFSM"));
     }
@@ -10,6 +10,14 @@
 
 #include "ASMBaseFSMState.generated.h"
 
+/*How often OnUpdate is called while the state is active*/
+UENUM(BlueprintType)
+enum class EFSMStateUpdateRate : uint8 {
+    EEveryFrame = 0 UMETA(DisplayName = "Every Frame"),
+    EHigh = 1 UMETA(DisplayName = "10 Times per Second"),
+    ELow = 2 UMETA(DisplayName = "2 Times per Second"),
+    ENone = 3 UMETA(DisplayName = "Never (Event Driven)"),
+};
 
 /**
  *
@@ -37,7 +45,17 @@ public:
         return actorOwner;
     }
 
+    UFUNCTION(BlueprintPure, Category = ASM)
+    EFSMStateUpdateRate GetUpdateRate() const
+    {
+        return UpdateRate;
+    }
+
 protected:
+    /*States that only react to events and transitions should use Never, they won't be updated at all*/
+    UPROPERTY(EditDefaultsOnly, Category = ASM)
+    EFSMStateUpdateRate UpdateRate = EFSMStateUpdateRate::EEveryFrame;
+
     UPROPERTY(BlueprintReadOnly, Category = ASM)
     class APlayerController* LocalController;
 
@@ -9,11 +9,17 @@
 #include "ASMFSMComponent.generated.h"
 
 
+/**
+ * Runs an UASMStateMachine for its owner. The component doesn't tick: the FSM is updated by the
+ * UASMFSMUpdateSubsystem at the update rate of its current state, together with the other FSMs of the world.
+ */
 UCLASS(BlueprintType, ClassGroup=(ATS), meta=(BlueprintSpawnableComponent) )
 class ASCENTSTATEMACHINE_API UASMFSMComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UASMFSMUpdateSubsystem;
+
 public:	
 	// Sets default values for this component's properties
 	UASMFSMComponent();
@@ -36,9 +42,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = ASM)
 	bool bShouldDisplayDebugInfo = false;
 
-	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
-	virtual void PostInitProperties() override;
 public:	
 
 	/*Starts the actual FSM calling OnEnter on the StartNode State*/
@@ -107,6 +110,23 @@ private:
 
 	FGameplayTag pendingTransition;
 
+	class UASMFSMUpdateSubsystem* GetUpdateSubsystem() const;
+
+	void HandleCurrentStateChanged();
+
+	/*Called by the update subsystem*/
+	void UpdateFSM(float deltaTime);
+	void ResolvePendingTransition();
+	int32 GetDesiredUpdateBucket() const;
+
+	/*Bookkeeping of the update subsystem*/
+	int32 UpdateBucket = INDEX_NONE;
+	int32 UpdateSlot = INDEX_NONE;
+	bool bUpdateRateDirty = false;
+	bool bTransitionQueued = false;
+
+	FDelegateHandle stateChangedHandle;
+
 
 /*	TObjectPtr<UASMStateMachine> FSM;*/
 };
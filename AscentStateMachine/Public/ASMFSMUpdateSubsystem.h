@@ -0,0 +1,68 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ASMBaseFSMState.h"
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ASMFSMUpdateSubsystem.generated.h"
+
+class UASMFSMComponent;
+
+/**
+ * Updates every UASMFSMComponent of the world instead of their own tick functions.
+ * Components are grouped in one bucket per EFSMStateUpdateRate of their current state, each bucket is
+ * updated in a single loop when its interval elapses. Components whose state is event driven, or whose
+ * FSM is not running, are in no bucket at all. Transitions triggered through the components are
+ * resolved in a batch after each bucket update, the bucket changes they cause at the end of the frame.
+ */
+UCLASS()
+class ASCENTSTATEMACHINE_API UASMFSMUpdateSubsystem : public UTickableWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual void Deinitialize() override;
+
+    /*The bucket of component will be refreshed from its current state before the next update*/
+    void MarkUpdateRateDirty(UASMFSMComponent* component);
+
+    /*Queues the pending transition of component for the next batch*/
+    void QueuePendingTransition(UASMFSMComponent* component);
+
+    void RemoveComponent(UASMFSMComponent* component);
+
+    UFUNCTION(BlueprintPure, Category = ASM)
+    int32 GetUpdatedComponentsNum() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FUpdateBucket {
+        float Interval = 0.f;
+        float ElapsedTime = 0.f;
+
+        /*Removed components leave a null slot until the bucket is compacted*/
+        TArray<UASMFSMComponent*> Components;
+        int32 NumRemoved = 0;
+    };
+
+    static constexpr int32 NumBuckets = static_cast<int32>(EFSMStateUpdateRate::ENone);
+
+    FUpdateBucket Buckets[NumBuckets];
+
+    TArray<UASMFSMComponent*> DirtyComponents;
+    TArray<UASMFSMComponent*> PendingTransitions;
+
+    void UpdateBucket(FUpdateBucket& bucket, float deltaTime);
+    void CompactBucket(FUpdateBucket& bucket);
+
+    void ResolvePendingTransitions();
+    void RefreshDirtyComponents();
+
+    void RemoveFromBucket(UASMFSMComponent* component);
+};
@@ -65,6 +65,9 @@ public:
 
 	void DispatchTick(float DeltaTime);
 
+	/*Broadcast whenever the current state changes, including when the FSM starts and stops*/
+	FSimpleMulticastDelegate OnCurrentStateChanged;
+
 	UWorld* GetWorld() const override { return fsmOwner ? fsmOwner->GetWorld() : nullptr; }
 
 };
@@ -0,0 +1,233 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ATSTargetableSubsystem.h"
+#include "ATSTargetPointComponent.h"
+#include "ATSTargetableInterface.h"
+#include "EngineUtils.h"
+#include "GenericTeamAgentInterface.h"
+#include <Engine/Level.h>
+#include <Engine/World.h>
+#include <GameFramework/Actor.h>
+
+void UATSTargetableSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    for (TActorIterator<AActor> it(&InWorld); it; ++it) {
+        RegisterTargetable(*it);
+    }
+
+    ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UATSTargetableSubsystem::HandleActorSpawned));
+    ActorDestroyedHandle = InWorld.AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UATSTargetableSubsystem::HandleActorDestroyed));
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UATSTargetableSubsystem::HandleLevelAdded);
+}
+
+void UATSTargetableSubsystem::Deinitialize()
+{
+    if (UWorld* world = GetWorld()) {
+        world->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        world->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+    }
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+    Actors.Empty();
+    RowKeys.Empty();
+    Locations.Empty();
+    TeamIds.Empty();
+    TargetPoints.Empty();
+    FreeRows.Empty();
+    Indices.Empty();
+    SortedRows.Empty();
+    RowCells.Empty();
+    Cells.Empty();
+
+    Super::Deinitialize();
+}
+
+void UATSTargetableSubsystem::RegisterTargetable(AActor* targetable)
+{
+    if (!targetable || Indices.Contains(targetable) || !targetable->GetClass()->ImplementsInterface(UATSTargetableInterface::StaticClass())) {
+        return;
+    }
+
+    const int32 row = AllocateRow();
+    Actors[row] = targetable;
+    RowKeys[row] = targetable;
+    Locations[row] = targetable->GetActorLocation();
+    TeamIds[row] = FGenericTeamId::GetTeamIdentifier(targetable).GetId();
+    Indices.Add(targetable, row);
+    RefreshTargetPoints(targetable);
+
+    // New rows are bucketed on the next query
+    GridFrame = MAX_uint64;
+}
+
+void UATSTargetableSubsystem::UnregisterTargetable(AActor* targetable)
+{
+    if (const int32* row = Indices.Find(targetable)) {
+        FreeRow(*row);
+    }
+}
+
+void UATSTargetableSubsystem::RefreshTargetPoints(AActor* targetable)
+{
+    const int32* row = Indices.Find(targetable);
+    if (!row) {
+        return;
+    }
+
+    TArray<UATSTargetPointComponent*> points;
+    targetable->GetComponents<UATSTargetPointComponent>(points, true);
+
+    TArray<TWeakObjectPtr<UATSTargetPointComponent>>& rowPoints = TargetPoints[*row];
+    rowPoints.Reset(points.Num());
+    for (UATSTargetPointComponent* point : points) {
+        rowPoints.Add(point);
+    }
+}
+
+const TArray<TWeakObjectPtr<UATSTargetPointComponent>>* UATSTargetableSubsystem::GetTargetPoints(const AActor* targetable) const
+{
+    const int32* row = Indices.Find(targetable);
+    return row ? &TargetPoints[*row] : nullptr;
+}
+
+void UATSTargetableSubsystem::QueryTargets(const FATSTargetableQuery& query, TArray<AActor*>& outTargets)
+{
+    UpdateGrid();
+
+    const FVector extent(query.Radius, query.Radius, 0.f);
+    const FIntPoint minCell = GetCell(query.Origin - extent);
+    const FIntPoint maxCell = GetCell(query.Origin + extent);
+
+    TArray<int32, TInlineAllocator<128>> candidates;
+    auto gatherCell = [&](const FCellRange& range) {
+        candidates.Append(&SortedRows[range.Start], range.Num);
+    };
+
+    const int64 cellsInRange = int64(maxCell.X - minCell.X + 1) * int64(maxCell.Y - minCell.Y + 1);
+    if (cellsInRange > Cells.Num()) {
+        for (const auto& cell : Cells) {
+            gatherCell(cell.Value);
+        }
+    } else {
+        for (int32 x = minCell.X; x <= maxCell.X; ++x) {
+            for (int32 y = minCell.Y; y <= maxCell.Y; ++y) {
+                if (const FCellRange* range = Cells.Find(FIntPoint(x, y))) {
+                    gatherCell(*range);
+                }
+            }
+        }
+    }
+
+    // Native predicates on the packed rows first, actors are only resolved for the survivors
+    const float radiusSquared = FMath::Square(query.Radius);
+    const FVector* locations = Locations.GetData();
+    const uint8* teamIds = TeamIds.GetData();
+    int32 numSurvivors = 0;
+    for (const int32 row : candidates) {
+        const bool bInRange = FVector::DistSquared(locations[row], query.Origin) <= radiusSquared;
+        const bool bAllowedTeam = !query.ExcludedTeams[teamIds[row]];
+        candidates[numSurvivors] = row;
+        numSurvivors += bInRange && bAllowedTeam;
+    }
+
+    for (int32 index = 0; index < numSurvivors; ++index) {
+        AActor* actor = Actors[candidates[index]].Get();
+        if (actor && actor != query.IgnoredActor) {
+            outTargets.Add(actor);
+        }
+    }
+}
+
+void UATSTargetableSubsystem::HandleActorSpawned(AActor* actor)
+{
+    RegisterTargetable(actor);
+}
+
+void UATSTargetableSubsystem::HandleActorDestroyed(AActor* actor)
+{
+    UnregisterTargetable(actor);
+}
+
+void UATSTargetableSubsystem::HandleLevelAdded(ULevel* level, UWorld* world)
+{
+    if (world != GetWorld() || !level) {
+        return;
+    }
+
+    for (AActor* actor : level->Actors) {
+        RegisterTargetable(actor);
+    }
+}
+
+int32 UATSTargetableSubsystem::AllocateRow()
+{
+    if (FreeRows.Num() > 0) {
+        return FreeRows.Pop(EAllowShrinking::No);
+    }
+
+    Actors.AddDefaulted();
+    RowKeys.AddDefaulted();
+    Locations.AddDefaulted();
+    TeamIds.Add(FGenericTeamId::NoTeam.GetId());
+    TargetPoints.AddDefaulted();
+    RowCells.AddDefaulted();
+    return Actors.Num() - 1;
+}
+
+void UATSTargetableSubsystem::FreeRow(int32 row)
+{
+    Indices.Remove(RowKeys[row]);
+    Actors[row].Reset();
+    RowKeys[row] = TObjectKey<AActor>();
+    TargetPoints[row].Empty();
+    FreeRows.Add(row);
+    GridFrame = MAX_uint64;
+}
+
+void UATSTargetableSubsystem::UpdateGrid()
+{
+    if (GridFrame == GFrameCounter) {
+        return;
+    }
+
+    SortedRows.Reset(Indices.Num());
+    for (int32 row = 0; row < Actors.Num(); ++row) {
+        const AActor* actor = Actors[row].Get();
+        if (!actor) {
+            // Destroyed without notification, e.g. with its streamed level
+            if (RowKeys[row] != TObjectKey<AActor>()) {
+                FreeRow(row);
+            }
+            continue;
+        }
+
+        Locations[row] = actor->GetActorLocation();
+        TeamIds[row] = FGenericTeamId::GetTeamIdentifier(actor).GetId();
+        RowCells[row] = GetCell(Locations[row]);
+        SortedRows.Add(row);
+    }
+    // Set after the pass, stale rows freed above invalidate it
+    GridFrame = GFrameCounter;
+
+    SortedRows.Sort([this](int32 first, int32 second) {
+        const FIntPoint& firstCell = RowCells[first];
+        const FIntPoint& secondCell = RowCells[second];
+        return firstCell.X != secondCell.X ? firstCell.X < secondCell.X : firstCell.Y < secondCell.Y;
+    });
+
+    Cells.Reset();
+    for (int32 index = 0; index < SortedRows.Num(); ++index) {
+        FCellRange& range = Cells.FindOrAdd(RowCells[SortedRows[index]]);
+        if (range.Num == 0) {
+            range.Start = index;
+        }
+        range.Num++;
+    }
+}
+
+FIntPoint UATSTargetableSubsystem::GetCell(const FVector& location) const
+{
+    return FIntPoint(FMath::FloorToInt(location.X / CellSize), FMath::FloorToInt(location.Y / CellSize));
+}
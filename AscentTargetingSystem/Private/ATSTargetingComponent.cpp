@@ -3,7 +3,9 @@
 #include "ATSTargetingComponent.h"
 #include "ATSTargetPointComponent.h"
 #include "ATSTargetableInterface.h"
+#include "ATSTargetableSubsystem.h"
 #include "CCMCameraFunctionLibrary.h"
+#include "GenericTeamAgentInterface.h"
 #include "Interfaces/ACFEntityInterface.h"
 #include <Camera/PlayerCameraManager.h>
 #include <Components/ActorComponent.h>
@@ -193,11 +195,10 @@ bool UATSTargetingComponent::TrySwitchPointOnCurrentTarget(ETargetingDirection d
     UATSTargetPointComponent* bestpoint = nullptr;
     TArray<UATSTargetPointComponent*> potentialTargets;
     if (CurrentTarget && CurrentTargetPoint) {
-        TArray<UActorComponent*> points;
-        CurrentTarget->GetComponents(UATSTargetPointComponent::StaticClass(), points, true);
+        TArray<UATSTargetPointComponent*> points;
+        GetTargetPoints(CurrentTarget, points);
         if (points.Num() > 1) {
-            for (auto point : points) {
-                UATSTargetPointComponent* targetpoint = Cast<UATSTargetPointComponent>(point);
+            for (UATSTargetPointComponent* targetpoint : points) {
                 if (targetpoint && targetpoint != CurrentTargetPoint) {
                     FVector PotentialTargetLocation = targetpoint->GetComponentLocation();
 
@@ -322,18 +323,8 @@ void UATSTargetingComponent::HandlePawnChanged(class APawn* newPawn)
 
 bool UATSTargetingComponent::IsValidTarget(AActor* target)
 {
-    if (target && ControlledPawn && target != ControlledPawn) {
-        bool bImplements = target->GetClass()->ImplementsInterface(UATSTargetableInterface::StaticClass());
-        if (bImplements) {
-            for (UATSTargetingFilter* filter : TargetFilters) {
-                if (filter && !filter->IsActorTargetable(GetOwner(), target)) {
-                    return false;
-                }
-            }
-            return true;
-        }
-    }
-    return false;
+    // availableTargets are already filtered by PopulatePotentialTargetsArray
+    return target && ControlledPawn && target != ControlledPawn;
 }
 
 bool UATSTargetingComponent::IsInFrontOfOwner(AActor* target)
@@ -430,16 +421,15 @@ UATSTargetPointComponent* UATSTargetingComponent::GetBestTargetPointForTarget(AA
     UATSTargetPointComponent* bestpoint = nullptr;
     float maxDirection = -1.f;
     if (target) {
-        TArray<UActorComponent*> points;
-        target->GetComponents(UATSTargetPointComponent::StaticClass(), points, true);
+        TArray<UATSTargetPointComponent*> points;
+        GetTargetPoints(target, points);
         FVector cameraForwardVector = UKismetMathLibrary::GetForwardVector(cameraManger->GetCameraRotation());
 
         cameraForwardVector.Z = 0;
         cameraForwardVector = cameraForwardVector.GetSafeNormal();
 
         if (points.Num() != 0) {
-            for (auto point : points) {
-                UATSTargetPointComponent* targetpoint = Cast<UATSTargetPointComponent>(point);
+            for (UATSTargetPointComponent* targetpoint : points) {
                 if (targetpoint) {
                     FVector distance = targetpoint->GetComponentLocation() - ControlledPawn->GetActorLocation();
                     distance = distance.GetUnsafeNormal();
@@ -494,11 +484,32 @@ void UATSTargetingComponent::PopulatePotentialTargetsArray()
     if (ControlledPawn) {
 
         availableTargets.Empty();
-        TArray<AActor*> ignoredActors;
-        ignoredActors.Add(ControlledPawn);
         TArray<AActor*> potentialTargets;
-        UKismetSystemLibrary::SphereOverlapActors(this, ControlledPawn->GetActorLocation(),
-            GetMaxTargetingDistance(), ObjectsToQuery, AActor::StaticClass(), ignoredActors, potentialTargets);
+        const FGenericTeamId ownerTeam = bIgnoreOwnerTeam ? FGenericTeamId::GetTeamIdentifier(ControlledPawn) : FGenericTeamId::NoTeam;
+
+        UATSTargetableSubsystem* registry = bUseTargetableRegistry ? GetWorld()->GetSubsystem<UATSTargetableSubsystem>() : nullptr;
+        if (registry) {
+            FATSTargetableQuery query;
+            query.Origin = ControlledPawn->GetActorLocation();
+            query.Radius = GetMaxTargetingDistance();
+            query.IgnoredActor = ControlledPawn;
+            if (ownerTeam != FGenericTeamId::NoTeam) {
+                query.ExcludedTeams[ownerTeam.GetId()] = true;
+            }
+            registry->QueryTargets(query, potentialTargets);
+        } else {
+            TArray<AActor*> ignoredActors;
+            ignoredActors.Add(ControlledPawn);
+            UKismetSystemLibrary::SphereOverlapActors(this, ControlledPawn->GetActorLocation(),
+                GetMaxTargetingDistance(), ObjectsToQuery, AActor::StaticClass(), ignoredActors, potentialTargets);
+
+            potentialTargets.RemoveAll([&](const AActor* target) {
+                return !target->GetClass()->ImplementsInterface(UATSTargetableInterface::StaticClass())
+                    || (ownerTeam != FGenericTeamId::NoTeam && FGenericTeamId::GetTeamIdentifier(target) == ownerTeam);
+            });
+        }
+
+        FilterPotentialTargets(potentialTargets);
 
         if (bCheckLineSight) {
             for (int32 i = potentialTargets.Num() - 1; i >= 0; i--) {
@@ -514,6 +525,38 @@ void UATSTargetingComponent::PopulatePotentialTargetsArray()
     }
 }
 
+void UATSTargetingComponent::FilterPotentialTargets(TArray<AActor*>& targets)
+{
+    const AActor* owner = GetOwner();
+    for (UATSTargetingFilter* filter : TargetFilters) {
+        if (filter && !filter->IsImplementedInBlueprint()) {
+            filter->FilterTargetsNative(owner, targets);
+        }
+    }
+
+    for (UATSTargetingFilter* filter : TargetFilters) {
+        if (filter && filter->IsImplementedInBlueprint()) {
+            targets.RemoveAll([&](const AActor* target) { return !filter->IsActorTargetable(owner, target); });
+        }
+    }
+}
+
+void UATSTargetingComponent::GetTargetPoints(AActor* target, TArray<UATSTargetPointComponent*>& outPoints) const
+{
+    const UATSTargetableSubsystem* registry = GetWorld()->GetSubsystem<UATSTargetableSubsystem>();
+    const TArray<TWeakObjectPtr<UATSTargetPointComponent>>* cachedPoints = registry ? registry->GetTargetPoints(target) : nullptr;
+    if (!cachedPoints) {
+        target->GetComponents<UATSTargetPointComponent>(outPoints, true);
+        return;
+    }
+
+    for (const TWeakObjectPtr<UATSTargetPointComponent>& point : *cachedPoints) {
+        if (UATSTargetPointComponent* targetPoint = point.Get()) {
+            outPoints.Add(targetPoint);
+        }
+    }
+}
+
 void UATSTargetingComponent::SwitchTargetByDirection(ETargetingDirection direction)
 {
     if (TrySwitchPointOnCurrentTarget(direction)) {
@@ -11,3 +11,15 @@ UATSTargetingFilter::UATSTargetingFilter()
 {
 
 }
+
+void UATSTargetingFilter::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	bImplementedInBlueprint = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UATSTargetingFilter, IsActorTargetable));
+}
+
+void UATSTargetingFilter::FilterTargetsNative(const AActor* componentOwner, TArray<AActor*>& targets)
+{
+	targets.RemoveAll([&](const AActor* target) { return !IsActorTargetable_Implementation(componentOwner, target); });
+}
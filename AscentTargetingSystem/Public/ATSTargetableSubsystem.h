@@ -0,0 +1,100 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticBitArray.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "ATSTargetableSubsystem.generated.h"
+
+class AActor;
+class UATSTargetPointComponent;
+
+/*Parameters of a UATSTargetableSubsystem::QueryTargets*/
+struct FATSTargetableQuery {
+    FVector Origin = FVector::ZeroVector;
+    float Radius = 0.f;
+
+    /*Never returned, usually the pawn looking for targets*/
+    const AActor* IgnoredActor = nullptr;
+
+    /*Generic team ids whose targetables are skipped*/
+    TStaticBitArray<256> ExcludedTeams;
+};
+
+/**
+ * Registry of the actors implementing ATSTargetableInterface in the world.
+ * Actors are registered when they are spawned or their level is loaded, their location and team are
+ * refreshed at most once per frame, and only in frames where targets are queried, then bucketed in a
+ * uniform grid. Queries only visit the cells around the origin and need no physics overlap.
+ * The target points of every targetable are gathered once, at registration.
+ */
+UCLASS()
+class ASCENTTARGETINGSYSTEM_API UATSTargetableSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    /*Adds the actor to the registry, does nothing if it doesn't implement ATSTargetableInterface*/
+    UFUNCTION(BlueprintCallable, Category = ATS)
+    void RegisterTargetable(AActor* targetable);
+
+    UFUNCTION(BlueprintCallable, Category = ATS)
+    void UnregisterTargetable(AActor* targetable);
+
+    /*Gathers again the target points of the actor, call it after adding or removing them at runtime*/
+    UFUNCTION(BlueprintCallable, Category = ATS)
+    void RefreshTargetPoints(AActor* targetable);
+
+    UFUNCTION(BlueprintPure, Category = ATS)
+    bool IsTargetable(const AActor* actor) const { return actor && Indices.Contains(actor); }
+
+    /*Cached target points of a registered targetable, nullptr if the actor isn't registered*/
+    const TArray<TWeakObjectPtr<UATSTargetPointComponent>>* GetTargetPoints(const AActor* targetable) const;
+
+    /*Appends to outTargets the registered targetables matching query*/
+    void QueryTargets(const FATSTargetableQuery& query, TArray<AActor*>& outTargets);
+
+private:
+    struct FCellRange {
+        int32 Start = 0;
+        int32 Num = 0;
+    };
+
+    static constexpr float CellSize = 1000.f;
+
+    // One row per targetable, freed rows are recycled
+    TArray<TWeakObjectPtr<AActor>> Actors;
+    TArray<TObjectKey<AActor>> RowKeys;
+    TArray<FVector> Locations;
+    TArray<uint8> TeamIds;
+    TArray<TArray<TWeakObjectPtr<UATSTargetPointComponent>>> TargetPoints;
+
+    TArray<int32> FreeRows;
+    TMap<TObjectKey<AActor>, int32> Indices;
+
+    // Rows sorted by grid cell, each cell maps to its range in SortedRows
+    TArray<int32> SortedRows;
+    TArray<FIntPoint> RowCells;
+    TMap<FIntPoint, FCellRange> Cells;
+    uint64 GridFrame = MAX_uint64;
+
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+    FDelegateHandle LevelAddedHandle;
+
+    void HandleActorSpawned(AActor* actor);
+    void HandleActorDestroyed(AActor* actor);
+    void HandleLevelAdded(class ULevel* level, UWorld* world);
+
+    int32 AllocateRow();
+    void FreeRow(int32 row);
+
+    void UpdateGrid();
+
+    FIntPoint GetCell(const FVector& location) const;
+};
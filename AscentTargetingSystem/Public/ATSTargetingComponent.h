@@ -88,9 +88,18 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ATS)
     float UpperPitchLimitDegree = 75.f;
 
+    /*Look for targets in the ATSTargetableSubsystem registry instead of with a physics overlap on ObjectsToQuery*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ATS)
+    bool bUseTargetableRegistry = true;
+
+    /*Object types of the overlap used to look for targets when bUseTargetableRegistry is false*/
     UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = ATS)
     TArray<TEnumAsByte<EObjectTypeQuery>> ObjectsToQuery;
 
+    /*Targets in the same team of the controlled pawn are never selected*/
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = ATS)
+    bool bIgnoreOwnerTeam = false;
+
     /*Filters to avoid an acotr from being targeted*/
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Instanced, Category = ATS)
     TArray<class UATSTargetingFilter*> TargetFilters;
@@ -182,6 +191,11 @@ private:
 
     void PopulatePotentialTargetsArray();
 
+    /*Runs the native filters on the whole batch first, then the Blueprint ones on the survivors*/
+    void FilterPotentialTargets(TArray<AActor*>& targets);
+
+    void GetTargetPoints(AActor* target, TArray<UATSTargetPointComponent*>& outPoints) const;
+
     void SwitchTargetByDirection(ETargetingDirection direction);
 
     UATSTargetPointComponent* GetNearestTargetPoint(TArray<UATSTargetPointComponent*> points);
@@ -23,5 +23,17 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = ATS)
 		bool IsActorTargetable(const AActor* componentOwner, const AActor* Target);
 	virtual bool IsActorTargetable_Implementation(const AActor* componentOwner, const  AActor* Target);
+
+	virtual void PostInitProperties() override;
+
+	/*Removes the targets rejected by this filter in a single native pass, without going through the
+	Blueprint VM. Only called for filters not implemented in Blueprint, override it for batched checks*/
+	virtual void FilterTargetsNative(const AActor* componentOwner, TArray<AActor*>& targets);
+
+	/*True if IsActorTargetable is implemented in Blueprint and has to be called one target at a time*/
+	bool IsImplementedInBlueprint() const { return bImplementedInBlueprint; }
+
+private:
+	bool bImplementedInBlueprint = false;
 // 	
 };
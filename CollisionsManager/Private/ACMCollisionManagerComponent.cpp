@@ -12,8 +12,15 @@
 #include "NiagaraSystem.h"
 #include <Components/ActorComponent.h>
 #include <Components/MeshComponent.h>
+#include <Components/PrimitiveComponent.h>
 #include <Components/SceneComponent.h>
+#include <Components/SkinnedMeshComponent.h>
+#include <Components/StaticMeshComponent.h>
 #include <Engine/EngineTypes.h>
+#include <Engine/OverlapResult.h>
+#include <Engine/SkinnedAsset.h>
+#include <Engine/StaticMesh.h>
+#include <Engine/StaticMeshSocket.h>
 #include <Engine/World.h>
 #include <GameFramework/Actor.h>
 #include <GameFramework/GameMode.h>
@@ -52,7 +59,7 @@ void UACMCollisionManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayRe
     Super::EndPlay(EndPlayReason);
 }
 
-void UACMCollisionManagerComponent::UpdateCollisions()
+void UACMCollisionManagerComponent::UpdateCollisions(TArray<FACMTraceRequest>& outRequests)
 {
     if (damageMesh) {
         DisplayDebugTraces();
@@ -72,76 +79,65 @@ void UACMCollisionManagerComponent::UpdateCollisions()
             return;
         }
         if (CollisionChannels.IsValidIndex(0)) {
-            for (TPair<FName, FTraceInfo>& currentTrace : activatedTraces) {
-                if (damageMesh->DoesSocketExist(currentTrace.Value.StartSocket) && damageMesh->DoesSocketExist(currentTrace.Value.EndSocket)) {
-                    FHitResult hitRes;
+            FCollisionObjectQueryParams ObjectParams;
+            if (!GetObjectQueryParams(ObjectParams)) {
+                UE_LOG(LogTemp, Warning, TEXT("Invalid Collision Channel - UACMCollisionManagerComponent::UpdateCollisions()"));
+                return;
+            }
 
-                    const FVector StartPos = damageMesh->GetSocketLocation(currentTrace.Value.StartSocket);
-                    const FVector EndPos = damageMesh->GetSocketLocation(currentTrace.Value.EndSocket);
-                    const FRotator orientation = GetLineRotation(StartPos, EndPos);
-                    FCollisionQueryParams Params;
+            FCollisionQueryParams Params;
+            if (IgnoredActors.Num() > 0) {
+                Params.AddIgnoredActors(IgnoredActors);
+            }
 
-                    if (IgnoredActors.Num() > 0) {
-                        Params.AddIgnoredActors(IgnoredActors);
-                    }
+            if (bIgnoreOwner) {
+                Params.AddIgnoredActor(GetActorOwner());
+                Params.AddIgnoredActor(GetOwner());
+            }
 
-                    if (bIgnoreOwner) {
-                        Params.AddIgnoredActor(GetActorOwner());
-                        Params.AddIgnoredActor(GetOwner());
-                    }
+            Params.bReturnPhysicalMaterial = true;
+            Params.bTraceComplex = true;
 
-                    Params.bReturnPhysicalMaterial = true;
-                    Params.bTraceComplex = true;
+            for (TPair<FName, FTraceInfo>& currentTrace : activatedTraces) {
+                FTraceInfo& trace = currentTrace.Value;
+                if (!trace.ResolvedStartSocket.bIsValid || !trace.ResolvedEndSocket.bIsValid) {
+                    UE_LOG(LogTemp, Warning, TEXT("Invalid Socket Names!! - UACMCollisionManagerComponent::UpdateCollisions()"));
+                    continue;
+                }
 
-                    FCollisionObjectQueryParams ObjectParams;
-                    for (const TEnumAsByte<ECollisionChannel>& channel : CollisionChannels) {
-                        if (ObjectParams.IsValidObjectQuery(channel)) {
-                            ObjectParams.AddObjectTypesToQuery(channel);
-                        }
-                    }
+                const FVector StartPos = GetResolvedSocketLocation(trace.ResolvedStartSocket);
+                const FVector EndPos = GetResolvedSocketLocation(trace.ResolvedEndSocket);
 
-                    if (!bAllowMultipleHitsPerSwing) {
-                        FHitActors* hitResact = alreadyHitActors.Find(currentTrace.Key);
-                        if (hitResact && hitResact->AlreadyHitActors.Num() > 0) {
-                            Params.AddIgnoredActors(hitResact->AlreadyHitActors);
-                        }
-                    }
+                FACMTraceRequest& request = outRequests.AddDefaulted_GetRef();
+                request.Component = this;
+                request.TraceName = currentTrace.Key;
+                request.Radius = trace.Radius;
+                request.ObjectParams = ObjectParams;
+                request.Params = Params;
 
-                    if (ObjectParams.IsValid() == false) {
-                        UE_LOG(LogTemp, Warning, TEXT("Invalid Collision Channel - UACMCollisionManagerComponent::UpdateCollisions()"));
-                        return;
+                if (!bAllowMultipleHitsPerSwing) {
+                    const FHitActors* hitResact = alreadyHitActors.Find(currentTrace.Key);
+                    if (hitResact && hitResact->AlreadyHitActors.Num() > 0) {
+                        request.Params.AddIgnoredActors(hitResact->AlreadyHitActors);
                     }
+                }
 
-                    UWorld* world = GetWorld();
-                    if (world) {
-                        bool bHit = world->SweepSingleByObjectType(
-                            hitRes, StartPos, EndPos, orientation.Quaternion(), ObjectParams, FCollisionShape::MakeSphere(currentTrace.Value.Radius), Params);
-
-                        if (!bHit && currentTrace.Value.bCrossframeAccuracy && !currentTrace.Value.bIsFirstFrame) {
-                            const FRotator oldOrient = GetLineRotation(StartPos, EndPos);
-                            bHit = world->SweepSingleByObjectType(
-                                hitRes, StartPos, currentTrace.Value.oldEndSocketPos, oldOrient.Quaternion(), ObjectParams, FCollisionShape::MakeSphere(currentTrace.Value.Radius), Params);
-                        }
-                        if (bHit) {
-                            OnCollisionDetected.Broadcast(hitRes);
-                            if (!bAllowMultipleHitsPerSwing) {
-                                FHitActors* hitResact = alreadyHitActors.Find(currentTrace.Key);
-                                if (hitResact) {
-                                    hitResact->AlreadyHitActors.Add(hitRes.GetActor());
-                                } else {
-                                    FHitActors newHit;
-                                    newHit.AlreadyHitActors.Add(hitRes.GetActor());
-                                    alreadyHitActors.Add(currentTrace.Key, newHit);
-                                }
-                            }
-                            ApplyDamage(hitRes, currentTrace.Value);
-                        }
-                        currentTrace.Value.bIsFirstFrame = false;
-                        currentTrace.Value.oldEndSocketPos = EndPos;
+                request.Segments.Emplace(StartPos, EndPos);
+                if (trace.bCrossframeAccuracy && !trace.bIsFirstFrame) {
+                    request.Segments.Emplace(StartPos, trace.oldEndSocketPos);
+
+                    // Substeps interpolate the blade between last frame and this one, one every blade width travelled
+                    const float travel = FMath::Max(FVector::Dist(trace.oldStartSocketPos, StartPos), FVector::Dist(trace.oldEndSocketPos, EndPos));
+                    const int32 substeps = FMath::Clamp(FMath::CeilToInt(travel / FMath::Max(trace.Radius * 2.f, 1.f)), 1, FMath::Max(trace.MaxSubsteps, 1));
+                    for (int32 step = 1; step < substeps; ++step) {
+                        const float alpha = static_cast<float>(step) / substeps;
+                        request.Segments.Emplace(FMath::Lerp(trace.oldStartSocketPos, StartPos, alpha), FMath::Lerp(trace.oldEndSocketPos, EndPos, alpha));
                     }
-                } else {
-                    UE_LOG(LogTemp, Warning, TEXT("Invalid Socket Names!! - UACMCollisionManagerComponent::UpdateCollisions()"));
                 }
+
+                trace.bIsFirstFrame = false;
+                trace.oldStartSocketPos = StartPos;
+                trace.oldEndSocketPos = EndPos;
             }
         } else {
             SetStarted(false);
@@ -149,6 +145,71 @@ void UACMCollisionManagerComponent::UpdateCollisions()
     }
 }
 
+void UACMCollisionManagerComponent::HandleTraceHit(const FName& traceName, const FHitResult& hitResult)
+{
+    const FTraceInfo* trace = activatedTraces.Find(traceName);
+    if (!trace || pendingDelete.Contains(traceName) || !IsValid(hitResult.GetActor())) {
+        return;
+    }
+
+    if (!bAllowMultipleHitsPerSwing) {
+        FHitActors& hitResact = alreadyHitActors.FindOrAdd(traceName);
+        if (hitResact.AlreadyHitActors.Contains(hitResult.GetActor())) {
+            return;
+        }
+        hitResact.AlreadyHitActors.Add(hitResult.GetActor());
+    }
+
+    OnCollisionDetected.Broadcast(hitResult);
+    ApplyDamage(hitResult, *trace);
+}
+
+void UACMCollisionManagerComponent::ResolveTraceSockets(FTraceInfo& trace) const
+{
+    trace.ResolvedStartSocket = ResolveSocket(trace.StartSocket);
+    trace.ResolvedEndSocket = ResolveSocket(trace.EndSocket);
+}
+
+FACMResolvedSocket UACMCollisionManagerComponent::ResolveSocket(const FName& socketName) const
+{
+    FACMResolvedSocket socket;
+    socket.SocketName = socketName;
+    if (!damageMesh || !damageMesh->DoesSocketExist(socketName)) {
+        return socket;
+    }
+    socket.bIsValid = true;
+
+    if (skinnedDamageMesh) {
+        const USkinnedAsset* skinnedAsset = skinnedDamageMesh->GetSkinnedAsset();
+        int32 socketIndex = INDEX_NONE;
+        if (skinnedAsset && skinnedAsset->FindSocketInfo(socketName, socket.LocalTransform, socket.BoneIndex, socketIndex) && socket.BoneIndex != INDEX_NONE) {
+            socket.bIsResolved = true;
+        } else {
+            socket.LocalTransform = FTransform::Identity;
+            socket.BoneIndex = skinnedDamageMesh->GetBoneIndex(socketName);
+            socket.bIsResolved = socket.BoneIndex != INDEX_NONE;
+        }
+    } else if (const UStaticMeshComponent* staticMesh = Cast<UStaticMeshComponent>(damageMesh)) {
+        const UStaticMeshSocket* meshSocket = staticMesh->GetStaticMesh() ? staticMesh->GetStaticMesh()->FindSocket(socketName) : nullptr;
+        if (meshSocket) {
+            socket.LocalTransform = FTransform(meshSocket->RelativeRotation, meshSocket->RelativeLocation, meshSocket->RelativeScale);
+            socket.bIsResolved = true;
+        }
+    }
+    return socket;
+}
+
+FVector UACMCollisionManagerComponent::GetResolvedSocketLocation(const FACMResolvedSocket& socket) const
+{
+    if (!socket.bIsResolved) {
+        return damageMesh->GetSocketLocation(socket.SocketName);
+    }
+    if (socket.BoneIndex != INDEX_NONE) {
+        return skinnedDamageMesh->GetBoneTransform(socket.BoneIndex).TransformPosition(socket.LocalTransform.GetLocation());
+    }
+    return damageMesh->GetComponentTransform().TransformPosition(socket.LocalTransform.GetLocation());
+}
+
 FTraceInfo UACMCollisionManagerComponent::GetFirstTrace() const
 {
     for (const auto& trace : DamageTraces) {
@@ -184,6 +245,11 @@ FRotator UACMCollisionManagerComponent::GetLineRotation(FVector start, FVector e
 void UACMCollisionManagerComponent::SetupCollisionManager(class UMeshComponent* inDamageMesh)
 {
     damageMesh = inDamageMesh;
+    skinnedDamageMesh = Cast<USkinnedMeshComponent>(damageMesh);
+
+    for (TPair<FName, FTraceInfo>& trace : activatedTraces) {
+        ResolveTraceSockets(trace.Value);
+    }
 
     if (!damageMesh) {
         UE_LOG(LogTemp, Warning, TEXT("Invalid Damage mesh!!"));
@@ -226,6 +292,31 @@ void UACMCollisionManagerComponent::PerformAreaDamage_Single_Implementation(cons
 
 void UACMCollisionManagerComponent::PerformAreaDamage_Single_Local(const FVector& damageCenter, float damageRadius, TArray<FHitResult>& outHits, TSubclassOf<UDamageType> damageTypeOverride)
 {
+    TArray<FAreaDamageRequest> requests;
+    requests.Emplace(damageCenter, damageRadius, damageTypeOverride);
+    PerformAreaDamage_Batch_Local(requests, outHits);
+}
+
+void UACMCollisionManagerComponent::PerformAreaDamage_Batch_Implementation(const TArray<FAreaDamageRequest>& requests)
+{
+    TArray<FHitResult> outHits;
+    PerformAreaDamage_Batch_Local(requests, outHits);
+}
+
+void UACMCollisionManagerComponent::PerformAreaDamage_Batch_Local(const TArray<FAreaDamageRequest>& requests, TArray<FHitResult>& outHits)
+{
+    outHits.Empty();
+    UWorld* world = GetWorld();
+    if (!world) {
+        return;
+    }
+
+    FCollisionObjectQueryParams ObjectParams;
+    if (!GetObjectQueryParams(ObjectParams)) {
+        UE_LOG(LogTemp, Warning, TEXT("Invalid Collision Channel - UACMCollisionManagerComponent::PerformAreaDamage_Batch_Local()"));
+        return;
+    }
+
     FCollisionQueryParams Params;
     if (IgnoredActors.Num() > 0) {
         Params.AddIgnoredActors(IgnoredActors);
@@ -235,32 +326,105 @@ void UACMCollisionManagerComponent::PerformAreaDamage_Single_Local(const FVector
         Params.AddIgnoredActor(GetActorOwner());
     }
 
-    UWorld* world = GetWorld();
-    alreadyHitActorsBySphere.Empty();
-    outHits.Empty();
-    if (world) {
-        for (const TEnumAsByte<ECollisionChannel>& channel : CollisionChannels) {
-            TArray<FHitResult> outResults;
-            const bool bHit = world->SweepMultiByChannel(outResults, damageCenter, damageCenter + FVector(1.f), FQuat::Identity, channel, FCollisionShape::MakeSphere(damageRadius), Params);
+    // Greedy clustering, a request joins a cluster if the merged bounds stay close to the size of the two alone
+    TArray<TArray<int32>> clusters;
+    TArray<FBox> clustersBounds;
+    for (int32 index = 0; index < requests.Num(); ++index) {
+        const FAreaDamageRequest& request = requests[index];
+        if (request.Radius <= 0.f) {
+            continue;
+        }
 
-            if (bHit) {
-                outHits.Append(outResults);
+        const FBox bounds = FBox::BuildAABB(request.Location, FVector(request.Radius));
+        int32 clusterIndex = INDEX_NONE;
+        for (int32 candidate = 0; candidate < clusters.Num(); ++candidate) {
+            const FBox merged = clustersBounds[candidate] + bounds;
+            if (merged.GetVolume() <= 2.f * (clustersBounds[candidate].GetVolume() + bounds.GetVolume())) {
+                clusterIndex = candidate;
+                clustersBounds[candidate] = merged;
+                break;
             }
         }
-        for (const auto& hit : outHits) {
-            if (!alreadyHitActorsBySphere.Contains(hit.GetActor())) {
-                alreadyHitActorsBySphere.Add(hit.GetActor());
-                FBaseTraceInfo damageInfo = AreaDamageTraceInfo;
-                if (damageTypeOverride) {
-                    damageInfo.DamageTypeClass = damageTypeOverride;
+
+        if (clusterIndex == INDEX_NONE) {
+            clusters.AddDefaulted_GetRef().Add(index);
+            clustersBounds.Add(bounds);
+        } else {
+            clusters[clusterIndex].Add(index);
+        }
+    }
+
+    for (int32 clusterIndex = 0; clusterIndex < clusters.Num(); ++clusterIndex) {
+        PerformAreaDamageCluster(requests, clusters[clusterIndex], clustersBounds[clusterIndex], ObjectParams, Params, outHits);
+    }
+
+    if ((uint8)ShowDebugInfo > 0) {
+        for (const FAreaDamageRequest& request : requests) {
+            ShowDebugTrace(request.Location, request.Location + FVector(1.f), request.Radius, EDrawDebugTrace::ForDuration, 3.f, FColor::Red);
+        }
+    }
+}
+
+void UACMCollisionManagerComponent::PerformAreaDamageCluster(const TArray<FAreaDamageRequest>& requests, const TArray<int32>& cluster, const FBox& clusterBounds,
+    const FCollisionObjectQueryParams& objectParams, const FCollisionQueryParams& params, TArray<FHitResult>& outHits)
+{
+    // A single request is queried with its own sphere, so every overlap is already in range
+    const bool bIsSingleRequest = cluster.Num() == 1;
+    const FVector queryCenter = bIsSingleRequest ? requests[cluster[0]].Location : clusterBounds.GetCenter();
+    const FCollisionShape queryShape = bIsSingleRequest ? FCollisionShape::MakeSphere(requests[cluster[0]].Radius) : FCollisionShape::MakeBox(clusterBounds.GetExtent());
+
+    TArray<FOverlapResult> overlaps;
+    GetWorld()->OverlapMultiByObjectType(overlaps, queryCenter, FQuat::Identity, objectParams, queryShape, params);
+
+    TSet<AActor*> damagedActors;
+    damagedActors.Reserve(overlaps.Num());
+    for (const int32 index : cluster) {
+        const FAreaDamageRequest& request = requests[index];
+        FBaseTraceInfo damageInfo = AreaDamageTraceInfo;
+        if (request.DamageTypeOverride) {
+            damageInfo.DamageTypeClass = request.DamageTypeOverride;
+        }
+
+        damagedActors.Reset();
+        for (const FOverlapResult& overlap : overlaps) {
+            AActor* hitActor = overlap.GetActor();
+            UPrimitiveComponent* hitComponent = overlap.GetComponent();
+            if (!IsValid(hitActor) || !hitComponent || damagedActors.Contains(hitActor)) {
+                continue;
+            }
+
+            FVector impactPoint;
+            const float distance = hitComponent->GetClosestPointOnCollision(request.Location, impactPoint);
+            if (distance < 0.f) {
+                // No collision geometry to measure, fall back to the bounds
+                impactPoint = hitComponent->Bounds.Origin;
+                if (!bIsSingleRequest && FVector::Dist(impactPoint, request.Location) > request.Radius + hitComponent->Bounds.SphereRadius) {
+                    continue;
                 }
-                ApplyDamage(hit, damageInfo);
+            } else if (!bIsSingleRequest && distance > request.Radius) {
+                continue;
             }
+
+            damagedActors.Add(hitActor);
+            FHitResult& hit = outHits.Emplace_GetRef(hitActor, hitComponent, impactPoint, (impactPoint - request.Location).GetSafeNormal());
+            hit.bBlockingHit = true;
+            hit.ImpactPoint = impactPoint;
+            hit.TraceStart = request.Location;
+            hit.TraceEnd = request.Location;
+            ApplyDamage(hit, damageInfo);
         }
-        if ((uint8)ShowDebugInfo > 0) {
-            ShowDebugTrace(damageCenter, damageCenter + FVector(1.f), damageRadius, EDrawDebugTrace::ForDuration, 3.f, FColor::Red);
+    }
+}
+
+bool UACMCollisionManagerComponent::GetObjectQueryParams(FCollisionObjectQueryParams& outObjectParams) const
+{
+    outObjectParams = FCollisionObjectQueryParams();
+    for (const TEnumAsByte<ECollisionChannel>& channel : CollisionChannels) {
+        if (outObjectParams.IsValidObjectQuery(channel)) {
+            outObjectParams.AddObjectTypesToQuery(channel);
         }
     }
+    return outObjectParams.IsValid();
 }
 
 void UACMCollisionManagerComponent::PerformAreaDamageForDuration_Implementation(const FVector& damageCenter, float damageRadius, float duration, float damageInterval /*= 1.f*/)
@@ -405,7 +569,8 @@ void UACMCollisionManagerComponent::StartSingleTrace_Implementation(const FName&
             pendingDelete.Remove(Name);
         }
         outTrace->bIsFirstFrame = true;
-        activatedTraces.Add(Name, *outTrace);
+        FTraceInfo& activatedTrace = activatedTraces.Add(Name, *outTrace);
+        ResolveTraceSockets(activatedTrace);
         PlayTrails(Name);
         SetStarted(true);
     } else {
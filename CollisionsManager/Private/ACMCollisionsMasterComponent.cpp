@@ -3,6 +3,7 @@
 
 #include "ACMCollisionsMasterComponent.h"
 #include "ACMCollisionManagerComponent.h"
+#include <Engine/World.h>
 
 // Sets default values for this component's properties
 UACMCollisionsMasterComponent::UACMCollisionsMasterComponent()
@@ -29,20 +30,77 @@ void UACMCollisionsMasterComponent::BeginPlay()
 void UACMCollisionsMasterComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Last frame sweeps first, so their hits are ignored by the ones submitted this frame
+	ConsumeTraceResults();
+
 	for (UACMCollisionManagerComponent* del : pendingDelete) {
 		currentlyActiveComponents.Remove(del);
 	}
 
 	pendingDelete.Empty();
 
+	frameRequests.Reset();
 	for (UACMCollisionManagerComponent* comp : currentlyActiveComponents) {
 		if (IsValid(comp) &&  IsValid(comp->GetOwner())  ) {
-			comp->UpdateCollisions();
+			comp->UpdateCollisions(frameRequests);
 		}
 		else {
 			pendingDelete.Add(comp);
 		}
 	}
+
+	SubmitTraceRequests();
+}
+
+void UACMCollisionsMasterComponent::ConsumeTraceResults()
+{
+	UWorld* world = GetWorld();
+	if (!world) {
+		inFlightTraces.Reset();
+		return;
+	}
+
+	FTraceDatum traceData;
+	for (const FACMInFlightTrace& trace : inFlightTraces) {
+		UACMCollisionManagerComponent* comp = trace.Component.Get();
+		if (!IsValid(comp)) {
+			continue;
+		}
+
+		for (const FTraceHandle& handle : trace.Handles) {
+			if (!world->QueryTraceData(handle, traceData)) {
+				continue;
+			}
+			const FHitResult* hit = traceData.OutHits.FindByPredicate([](const FHitResult& result) { return result.bBlockingHit; });
+			if (hit) {
+				comp->HandleTraceHit(trace.TraceName, *hit);
+				break;
+			}
+		}
+	}
+	inFlightTraces.Reset();
+}
+
+void UACMCollisionsMasterComponent::SubmitTraceRequests()
+{
+	UWorld* world = GetWorld();
+	if (!world) {
+		return;
+	}
+
+	inFlightTraces.Reserve(frameRequests.Num());
+	for (const FACMTraceRequest& request : frameRequests) {
+		FACMInFlightTrace& trace = inFlightTraces.AddDefaulted_GetRef();
+		trace.Component = request.Component;
+		trace.TraceName = request.TraceName;
+
+		const FCollisionShape shape = FCollisionShape::MakeSphere(request.Radius);
+		for (const TPair<FVector, FVector>& segment : request.Segments) {
+			trace.Handles.Add(world->AsyncSweepByObjectType(EAsyncTraceType::Single, segment.Key, segment.Value, FQuat::Identity,
+				request.ObjectParams, shape, request.Params));
+		}
+	}
 }
 
 void UACMCollisionsMasterComponent::AddComponent(class UACMCollisionManagerComponent* compToAdd)
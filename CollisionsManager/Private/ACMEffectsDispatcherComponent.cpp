@@ -1,6 +1,7 @@
 // Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
 
 #include "ACMEffectsDispatcherComponent.h"
+#include "ACMImpactFXReceiverComponent.h"
 #include "ACMImpactsFXDataAsset.h"
 #include "ACMTypes.h"
 #include "GameFramework/Character.h"
@@ -13,6 +14,11 @@
 #include "NiagaraCommon.h"
 #include "NiagaraSystem.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "TimerManager.h"
 
 
 // Sets default values for this component's properties
@@ -28,17 +34,36 @@ UACMEffectsDispatcherComponent::UACMEffectsDispatcherComponent()
 void UACMEffectsDispatcherComponent::BeginPlay()
 {
     Super::BeginPlay();
-    // ...
+
+    // A receiver created when its first bundle is sent is not on the client yet, and the unreliable RPC is dropped
+    if (GetOwner()->HasAuthority()) {
+        for (FConstPlayerControllerIterator iterator = GetWorld()->GetPlayerControllerIterator(); iterator; ++iterator) {
+            if (APlayerController* playerController = iterator->Get()) {
+                GetOrCreateReceiver(playerController);
+            }
+        }
+        postLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &UACMEffectsDispatcherComponent::HandlePostLogin);
+    }
 }
 
-void UACMEffectsDispatcherComponent::ClientsPlayEffect_Implementation(const FActionEffect& effect, class ACharacter* instigator)
+void UACMEffectsDispatcherComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Internal_PlayEffect(instigator, effect);
+    FGameModeEvents::GameModePostLoginEvent.Remove(postLoginHandle);
+    postLoginHandle.Reset();
+
+    Super::EndPlay(EndPlayReason);
 }
 
-void UACMEffectsDispatcherComponent::ClientsPlayReplicatedEffect_Implementation(const FImpactFX& FXtoPlay)
+void UACMEffectsDispatcherComponent::HandlePostLogin(AGameModeBase* gameMode, APlayerController* newPlayer)
 {
-    SpawnSoundAndParticleAtLocation(FXtoPlay);
+    if (newPlayer && newPlayer->GetWorld() == GetWorld()) {
+        GetOrCreateReceiver(newPlayer);
+    }
+}
+
+void UACMEffectsDispatcherComponent::ClientsPlayEffect_Implementation(const FActionEffect& effect, class ACharacter* instigator)
+{
+    Internal_PlayEffect(instigator, effect);
 }
 
 void UACMEffectsDispatcherComponent::PlayReplicatedActionEffect_Implementation(const FActionEffect& effect, class ACharacter* instigator)
@@ -67,7 +92,88 @@ void UACMEffectsDispatcherComponent::PlayReplicatedImpact(const TSubclassOf<clas
 
 void UACMEffectsDispatcherComponent::PlayReplicatedEffect_Implementation(const FImpactFX& FXtoPlay)
 {
-    ClientsPlayReplicatedEffect(FXtoPlay);
+    UWorld* world = GetWorld();
+    if (!world) {
+        return;
+    }
+
+    if (pendingImpacts.Num() == 0) {
+        world->GetTimerManager().SetTimerForNextTick(this, &UACMEffectsDispatcherComponent::FlushPendingImpacts);
+    }
+    pendingImpacts.Add(FXtoPlay);
+}
+
+void UACMEffectsDispatcherComponent::FlushPendingImpacts()
+{
+    UWorld* world = GetWorld();
+    if (!world) {
+        pendingImpacts.Reset();
+        return;
+    }
+
+    const float cullDistanceSq = FMath::Square(ImpactsCullDistance);
+    const float outOfViewCullDistanceSq = FMath::Square(ImpactsOutOfViewCullDistance);
+    const int32 maxImpacts = FMath::Clamp(MaxImpactsPerBundle, 1, MAX_uint8);
+
+    // Distance squared and index of the impacts relevant to the current connection
+    TArray<TPair<float, int32>> relevantImpacts;
+    relevantImpacts.Reserve(pendingImpacts.Num());
+
+    for (FConstPlayerControllerIterator iterator = world->GetPlayerControllerIterator(); iterator; ++iterator) {
+        APlayerController* playerController = iterator->Get();
+        if (!playerController) {
+            continue;
+        }
+
+        FVector viewLocation;
+        FRotator viewRotation;
+        playerController->GetPlayerViewPoint(viewLocation, viewRotation);
+        const FVector viewDirection = viewRotation.Vector();
+
+        relevantImpacts.Reset();
+        for (int32 index = 0; index < pendingImpacts.Num(); ++index) {
+            const FVector toImpact = pendingImpacts[index].SpawnLocation.GetLocation() - viewLocation;
+            const float distanceSq = toImpact.SizeSquared();
+            if (distanceSq > cullDistanceSq) {
+                continue;
+            }
+            if (distanceSq > outOfViewCullDistanceSq && FVector::DotProduct(toImpact, viewDirection) < 0.f) {
+                continue;
+            }
+            relevantImpacts.Emplace(distanceSq, index);
+        }
+
+        if (relevantImpacts.Num() == 0) {
+            continue;
+        }
+
+        if (relevantImpacts.Num() > maxImpacts) {
+            relevantImpacts.Sort([](const TPair<float, int32>& first, const TPair<float, int32>& second) { return first.Key < second.Key; });
+            relevantImpacts.SetNum(maxImpacts, EAllowShrinking::No);
+        }
+
+        UACMImpactFXReceiverComponent* receiver = GetOrCreateReceiver(playerController);
+        if (receiver) {
+            FImpactFXBundle bundle;
+            for (const TPair<float, int32>& impact : relevantImpacts) {
+                bundle.AddImpact(pendingImpacts[impact.Value]);
+            }
+            receiver->ClientPlayImpacts(bundle);
+        }
+    }
+
+    pendingImpacts.Reset();
+}
+
+UACMImpactFXReceiverComponent* UACMEffectsDispatcherComponent::GetOrCreateReceiver(APlayerController* playerController) const
+{
+    UACMImpactFXReceiverComponent* receiver = playerController->FindComponentByClass<UACMImpactFXReceiverComponent>();
+    if (!receiver) {
+        receiver = NewObject<UACMImpactFXReceiverComponent>(playerController);
+        receiver->SetIsReplicated(true);
+        receiver->RegisterComponent();
+    }
+    return receiver;
 }
 
 void UACMEffectsDispatcherComponent::PlayEffectLocally(const FImpactFX& effect)
@@ -123,17 +229,18 @@ FAttachedComponents UACMEffectsDispatcherComponent::SpawnSoundAndParticleAttache
 
 void UACMEffectsDispatcherComponent::SpawnSoundAndParticleAtLocation(const FImpactFX& effect)
 {
+    // Impacts are fire and forget, particles come from the world pools and sounds don't need a component
     if (effect.ActionParticle) {
         UGameplayStatics::SpawnEmitterAtLocation(this, effect.ActionParticle, effect.SpawnLocation.GetLocation(),
-            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D());
+            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D(), true, EPSCPoolMethod::AutoRelease);
     }
 
     if (effect.ActionSound) {
-        UGameplayStatics::SpawnSoundAtLocation(this, effect.ActionSound, effect.SpawnLocation.GetLocation());
+        UGameplayStatics::PlaySoundAtLocation(this, effect.ActionSound, effect.SpawnLocation.GetLocation());
     }
 
     if (effect.NiagaraParticle) {
         UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, effect.NiagaraParticle, effect.SpawnLocation.GetLocation(),
-            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D());
+            effect.SpawnLocation.GetRotation().Rotator(), effect.SpawnLocation.GetScale3D(), true, true, ENCPoolMethod::AutoRelease);
     }
 }
@@ -0,0 +1,28 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACMImpactFXReceiverComponent.h"
+#include "ACMCollisionsFunctionLibrary.h"
+#include "ACMEffectsDispatcherComponent.h"
+
+UACMImpactFXReceiverComponent::UACMImpactFXReceiverComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void UACMImpactFXReceiverComponent::ClientPlayImpacts_Implementation(const FImpactFXBundle& bundle)
+{
+    UACMEffectsDispatcherComponent* effectDispatcher = UACMCollisionsFunctionLibrary::GetEffectDispatcher(this);
+    if (!effectDispatcher) {
+        return;
+    }
+
+    for (const FImpactFXBundleItem& item : bundle.Impacts) {
+        if (!bundle.Effects.IsValidIndex(item.EffectIndex) || !bundle.EffectScales.IsValidIndex(item.EffectIndex)) {
+            continue;
+        }
+        FImpactFX impact(bundle.Effects[item.EffectIndex], item.Location);
+        impact.SpawnLocation = FTransform(item.Normal.Rotation(), item.Location, bundle.EffectScales[item.EffectIndex]);
+        effectDispatcher->SpawnSoundAndParticleAtLocation(impact);
+    }
+}
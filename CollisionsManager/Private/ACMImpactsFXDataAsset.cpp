@@ -2,27 +2,91 @@
 
 #include "ACMImpactsFXDataAsset.h"
 #include "ACMTypes.h"
+#include "UObject/UObjectHash.h"
+
+void UACMImpactsFXDataAsset::PostLoad()
+{
+    Super::PostLoad();
+    BuildLookupTable();
+}
+
+#if WITH_EDITOR
+void UACMImpactsFXDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    // Rebuilt on the next impact, so edits made during PIE are picked up
+    bIsLookupBuilt = false;
+}
+#endif
 
 bool UACMImpactsFXDataAsset::TryGetImpactFX(const TSubclassOf<class UDamageType>& damageImpacting, class UPhysicalMaterial* materialImpacted, FBaseFX& outFXtoPlay)
 {
-    if (ImpactFXsByDamageType.Contains(damageImpacting)) {
-        const FImpactsArray& impacts = ImpactFXsByDamageType.FindChecked(damageImpacting);
-
-        if (impacts.ImpactsFX.Contains(materialImpacted)) {
-            const FMaterialImpactFX* matfx = impacts.ImpactsFX.FindByKey(materialImpacted);
-            outFXtoPlay = FBaseFX(matfx->ActionSound, matfx->NiagaraParticle, matfx->ActionParticle);
-            return true;
-        } 
-    } else {
-    //IF WE DON'T FIND THAT DAMAGE TYPE, WE TRY HIS CHILD CLASSES
-        for (auto& impfx : ImpactFXsByDamageType) {
-        if (damageImpacting->IsChildOf(impfx.Key)) {
-                const FImpactsArray& impacts = ImpactFXsByDamageType.FindChecked(impfx.Key);
-                const FMaterialImpactFX* matfx = impacts.ImpactsFX.FindByKey(materialImpacted);
-                outFXtoPlay = FBaseFX(matfx->ActionSound, matfx->NiagaraParticle, matfx->ActionParticle);
-                return true;
+    if (!damageImpacting) {
+        return false;
+    }
+
+    if (!bIsLookupBuilt) {
+        BuildLookupTable();
+    }
+
+    UClass* damageType = damageImpacting.Get();
+    const TPair<TObjectKey<UClass>, TObjectKey<UPhysicalMaterial>> key(damageType, materialImpacted);
+    const FBaseFX* impactFX = ImpactFXLookup.Find(key);
+
+    // Damage types loaded after the table was built are flattened on their first impact
+    if (!impactFX && !ResolvedDamageTypes.Contains(damageType)) {
+        ResolveDamageType(damageType);
+        impactFX = ImpactFXLookup.Find(key);
+    }
+
+    if (impactFX) {
+        outFXtoPlay = *impactFX;
+        return true;
+    }
+    return false;
+}
+
+void UACMImpactsFXDataAsset::BuildLookupTable()
+{
+    ImpactFXLookup.Reset();
+    ResolvedDamageTypes.Reset();
+
+    TArray<UClass*> derivedDamageTypes;
+    for (const auto& impacts : ImpactFXsByDamageType) {
+        UClass* damageType = impacts.Key.Get();
+        if (!damageType) {
+            continue;
+        }
+        ResolveDamageType(damageType);
+
+        derivedDamageTypes.Reset();
+        GetDerivedClasses(damageType, derivedDamageTypes, true);
+        for (UClass* derivedDamageType : derivedDamageTypes) {
+            if (!ResolvedDamageTypes.Contains(derivedDamageType)) {
+                ResolveDamageType(derivedDamageType);
             }
         }
     }
-    return false;
+    bIsLookupBuilt = true;
+}
+
+void UACMImpactsFXDataAsset::ResolveDamageType(UClass* damageType)
+{
+    ResolvedDamageTypes.Add(damageType);
+
+    // The closest configured class wins, then the first entry of each material like FindByKey did
+    for (UClass* current = damageType; current; current = current->GetSuperClass()) {
+        const FImpactsArray* impacts = ImpactFXsByDamageType.Find(current);
+        if (!impacts) {
+            continue;
+        }
+
+        for (const FMaterialImpactFX& impact : impacts->ImpactsFX) {
+            const TPair<TObjectKey<UClass>, TObjectKey<UPhysicalMaterial>> key(damageType, impact.ImpactMaterial);
+            if (!ImpactFXLookup.Contains(key)) {
+                ImpactFXLookup.Add(key, FBaseFX(impact.ActionSound, impact.NiagaraParticle, impact.ActionParticle));
+            }
+        }
+        return;
+    }
 }
@@ -3,3 +3,30 @@
 
 #include "ACMTypes.h"
 
+
+void FImpactFXBundle::AddImpact(const FImpactFX& impact)
+{
+    const FVector scale = impact.SpawnLocation.GetScale3D();
+    int32 effectIndex = INDEX_NONE;
+    for (int32 index = 0; index < Effects.Num(); ++index) {
+        const FBaseFX& effect = Effects[index];
+        if (effect.ActionSound == impact.ActionSound && effect.NiagaraParticle == impact.NiagaraParticle && effect.ActionParticle == impact.ActionParticle
+            && EffectScales[index].Equals(scale, 0.1f)) {
+            effectIndex = index;
+            break;
+        }
+    }
+
+    if (effectIndex == INDEX_NONE) {
+        if (Effects.Num() > MAX_uint8) {
+            return;
+        }
+        effectIndex = Effects.Emplace(impact.ActionSound, impact.NiagaraParticle, impact.ActionParticle);
+        EffectScales.Add(scale);
+    }
+
+    FImpactFXBundleItem& item = Impacts.AddDefaulted_GetRef();
+    item.EffectIndex = static_cast<uint8>(effectIndex);
+    item.Location = impact.SpawnLocation.GetLocation();
+    item.Normal = impact.SpawnLocation.GetRotation().GetForwardVector();
+}
@@ -8,6 +8,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include <CollisionQueryParams.h>
 #include <Engine/EngineTypes.h>
 #include <GameFramework/DamageType.h>
 
@@ -15,6 +16,28 @@
 
 class AActor;
 class UDamageType;
+class UACMCollisionManagerComponent;
+class USkinnedMeshComponent;
+
+/**
+ * Sweeps of one active trace for the current frame, gathered by UpdateCollisions and submitted
+ * asynchronously by UACMCollisionsMasterComponent in a single batch with every other active trace.
+ * Results are consumed the next frame.
+ */
+struct FACMTraceRequest {
+    TWeakObjectPtr<UACMCollisionManagerComponent> Component;
+
+    FName TraceName = NAME_None;
+
+    float Radius = 0.f;
+
+    /*Start and end of each sweep, the first blocking hit in this order is the one applied*/
+    TArray<TPair<FVector, FVector>, TInlineAllocator<4>> Segments;
+
+    FCollisionQueryParams Params;
+
+    FCollisionObjectQueryParams ObjectParams;
+};
 
 /**
  * Delegate triggered when a collision is detected.
@@ -160,6 +183,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACM)
     void PerformAreaDamage_Single_Local(const FVector& damageCenter, float damageRadius, TArray<FHitResult>& outHits, TSubclassOf<UDamageType> damageTypeOverride = nullptr);
 
+    /**
+     * Applies several area damages at once, e.g. all the explosions of a frame.
+     * @param requests The area damages to apply.
+     */
+    UFUNCTION(Server, Reliable, BlueprintCallable, Category = ACM)
+    void PerformAreaDamage_Batch(const TArray<FAreaDamageRequest>& requests);
+
+    /**
+     * Locally applies several area damages at once and returns the hit results.
+     * Nearby requests share a single overlap query, every actor is damaged at most once per request.
+     * @param requests The area damages to apply.
+     * @param outHits Array to store the resulting hit data of all the requests.
+     */
+    UFUNCTION(BlueprintCallable, Category = ACM)
+    void PerformAreaDamage_Batch_Local(const TArray<FAreaDamageRequest>& requests, TArray<FHitResult>& outHits);
+
     /**
      * Starts a timed area damage effect for a set duration.
      * @param damageCenter The center of the damage area.
@@ -348,9 +387,17 @@ public:
     FRotator GetLineRotation(FVector start, FVector end);
 
     /**
-     * Updates collision detections and relevant logic.
+     * Updates the active traces and gathers the sweeps they need this frame.
+     * @param outRequests Array the sweeps of this component are appended to.
+     */
+    void UpdateCollisions(TArray<FACMTraceRequest>& outRequests);
+
+    /**
+     * Applies the first blocking hit found by the sweeps of a trace, ignored if the trace stopped since.
+     * @param traceName The name of the trace that hit.
+     * @param hitResult The blocking hit.
      */
-    void UpdateCollisions();
+    void HandleTraceHit(const FName& traceName, const FHitResult& hitResult);
 
     /**
      * Retrieves the first trace configuration available.
@@ -363,6 +410,8 @@ private:
 
     TObjectPtr<UMeshComponent> damageMesh;
 
+    TObjectPtr<USkinnedMeshComponent> skinnedDamageMesh;
+
     UPROPERTY()
     TMap<FName, FTraceInfo> activatedTraces;
 
@@ -372,12 +421,24 @@ private:
     UPROPERTY()
     TMap<FName, FHitActors> alreadyHitActors;
 
-    TArray<TObjectPtr<AActor>> alreadyHitActorsBySphere;
     TArray<TObjectPtr<AActor>> alreadyHitActorsBySweep;
     bool bIsStarted = false;
 
     void DisplayDebugTraces();
 
+    /*Object types mask of all the collision channels, false if none is a valid object type*/
+    bool GetObjectQueryParams(FCollisionObjectQueryParams& outObjectParams) const;
+
+    /*Applies the requests at the given indices with one overlap query covering all of them*/
+    void PerformAreaDamageCluster(const TArray<FAreaDamageRequest>& requests, const TArray<int32>& cluster, const FBox& clusterBounds,
+        const FCollisionObjectQueryParams& objectParams, const FCollisionQueryParams& params, TArray<FHitResult>& outHits);
+
+    void ResolveTraceSockets(FTraceInfo& trace) const;
+
+    FACMResolvedSocket ResolveSocket(const FName& socketName) const;
+
+    FVector GetResolvedSocketLocation(const FACMResolvedSocket& socket) const;
+
     void ShowDebugTrace(const FVector& StartPos, const FVector& EndPos, const float radius, EDrawDebugTrace::Type DrawDebugType, float duration, FLinearColor DebugColor = FLinearColor::Red);
 
     UFUNCTION()
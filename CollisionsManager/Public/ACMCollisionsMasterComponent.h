@@ -3,9 +3,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ACMCollisionManagerComponent.h"
 #include "Components/ActorComponent.h"
+#include <WorldCollision.h>
 #include "ACMCollisionsMasterComponent.generated.h"
 
+/*Async sweeps submitted for one trace, in the priority order of its request*/
+struct FACMInFlightTrace {
+	TWeakObjectPtr<UACMCollisionManagerComponent> Component;
+	FName TraceName = NAME_None;
+	TArray<FTraceHandle, TInlineAllocator<4>> Handles;
+};
+
 
 UCLASS(ClassGroup = (ACF), meta = (BlueprintSpawnableComponent))
 class COLLISIONSMANAGER_API UACMCollisionsMasterComponent : public UActorComponent
@@ -35,4 +44,13 @@ private:
 
 	UPROPERTY()
 	TArray<class UACMCollisionManagerComponent*> pendingDelete;
+
+	/*Reused every frame to gather the sweeps of all the active components*/
+	TArray<FACMTraceRequest> frameRequests;
+
+	TArray<FACMInFlightTrace> inFlightTraces;
+
+	void ConsumeTraceResults();
+
+	void SubmitTraceRequests();
 };
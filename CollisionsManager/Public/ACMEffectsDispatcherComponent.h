@@ -21,15 +21,39 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UPROPERTY(EditDefaultsOnly, Category = ACM)
 	class UACMImpactsFXDataAsset* ImpactFXs;
+
+	/*Replicated impacts farther than this from a player view are not sent to that player*/
+	UPROPERTY(EditDefaultsOnly, Category = "ACM|Replication")
+	float ImpactsCullDistance = 6000.f;
+
+	/*Replicated impacts behind a player view are only sent to that player within this distance*/
+	UPROPERTY(EditDefaultsOnly, Category = "ACM|Replication")
+	float ImpactsOutOfViewCullDistance = 1500.f;
+
+	/*Max impacts sent to a connection per frame, the closest ones are kept*/
+	UPROPERTY(EditDefaultsOnly, Category = "ACM|Replication", meta = (ClampMin = 1, ClampMax = 255))
+	int32 MaxImpactsPerBundle = 32;
+
 private:
 
 	UFUNCTION(NetMulticast, Reliable, Category = ACM)
 	void ClientsPlayEffect(const FActionEffect& effect, class ACharacter* instigator );
 
-	UFUNCTION(NetMulticast, Reliable, Category = ACM)
-	void ClientsPlayReplicatedEffect(const FImpactFX& FXtoPlay);
+	/*Server side, impacts replicated this frame, sent as one bundle per connection on the next tick*/
+	TArray<FImpactFX> pendingImpacts;
+
+	void FlushPendingImpacts();
+
+	class UACMImpactFXReceiverComponent* GetOrCreateReceiver(class APlayerController* playerController) const;
+
+	/*Server side, receivers are created as soon as a player joins so they reach the client before the first bundle*/
+	FDelegateHandle postLoginHandle;
+
+	void HandlePostLogin(class AGameModeBase* gameMode, class APlayerController* newPlayer);
 
 
 
@@ -0,0 +1,24 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACMTypes.h"
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+
+#include "ACMImpactFXReceiverComponent.generated.h"
+
+/**
+ * Added by UACMEffectsDispatcherComponent to every player controller when the player joins.
+ * Gives the dispatcher a per connection channel for the impact bundles of each frame.
+ */
+UCLASS(ClassGroup = (ACF))
+class COLLISIONSMANAGER_API UACMImpactFXReceiverComponent : public UActorComponent {
+    GENERATED_BODY()
+
+public:
+    UACMImpactFXReceiverComponent();
+
+    UFUNCTION(Client, Unreliable, Category = ACM)
+    void ClientPlayImpacts(const FImpactFXBundle& bundle);
+};
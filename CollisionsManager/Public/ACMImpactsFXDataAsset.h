@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "ACMTypes.h"
+#include "UObject/ObjectKey.h"
 #include "ACMImpactsFXDataAsset.generated.h"
 
 /**
@@ -22,7 +23,26 @@ protected:
 
 public: 
 
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	UFUNCTION(BlueprintCallable, Category = ACM)
 	bool TryGetImpactFX(const TSubclassOf<class UDamageType>& damageImpacting, class UPhysicalMaterial* materialImpacted, FBaseFX& outFXtoPlay);
 
+private:
+
+	/*Flattened (damage type, material) table, damage types without fxs get the ones of their closest parent*/
+	TMap<TPair<TObjectKey<UClass>, TObjectKey<UPhysicalMaterial>>, FBaseFX> ImpactFXLookup;
+
+	/*Damage types already flattened in the table, with or without entries*/
+	TSet<TObjectKey<UClass>> ResolvedDamageTypes;
+
+	bool bIsLookupBuilt = false;
+
+	void BuildLookupTable();
+
+	void ResolveDamageType(UClass* damageType);
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "Engine/NetSerialization.h"
 #include "NiagaraSystem.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Sound/SoundCue.h"
@@ -44,6 +45,36 @@ public:
     FTimerHandle AreaLoopTimer;
 };
 
+USTRUCT(BlueprintType)
+struct FAreaDamageRequest {
+    GENERATED_BODY()
+
+public:
+    FAreaDamageRequest()
+    {
+        Location = FVector::ZeroVector;
+        Radius = 0.f;
+        DamageTypeOverride = nullptr;
+    }
+
+    FAreaDamageRequest(const FVector& inLocation, float inRadius, TSubclassOf<UDamageType> inDamageTypeOverride = nullptr)
+    {
+        Location = inLocation;
+        Radius = inRadius;
+        DamageTypeOverride = inDamageTypeOverride;
+    }
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = ACM)
+    FVector Location;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = ACM)
+    float Radius;
+
+    /** Optional, replaces the damage type of the Area Damage Trace Info*/
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = ACM)
+    TSubclassOf<UDamageType> DamageTypeOverride;
+};
+
 USTRUCT(BlueprintType)
 struct FHitActors {
     GENERATED_BODY()
@@ -204,6 +235,41 @@ public:
     FTransform SpawnLocation;
 };
 
+USTRUCT()
+struct FImpactFXBundleItem {
+    GENERATED_BODY()
+
+public:
+    /*Index in the Effects of the bundle*/
+    UPROPERTY()
+    uint8 EffectIndex = 0;
+
+    UPROPERTY()
+    FVector_NetQuantize Location;
+
+    UPROPERTY()
+    FVector_NetQuantizeNormal Normal;
+};
+
+/*Impacts of a frame relevant to a single connection, each fx is sent once however many impacts use it*/
+USTRUCT()
+struct FImpactFXBundle {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<FBaseFX> Effects;
+
+    UPROPERTY()
+    TArray<FVector_NetQuantize10> EffectScales;
+
+    UPROPERTY()
+    TArray<FImpactFXBundleItem> Impacts;
+
+    /*Adds the impact, sharing the effect entry with the previous impacts of the same fx*/
+    void AddImpact(const FImpactFX& impact);
+};
+
 USTRUCT(BlueprintType)
 struct FMaterialImpactFX : public FBaseFX {
     GENERATED_BODY()
@@ -249,6 +315,21 @@ public:
     TArray<FMaterialImpactFX> ImpactsFX;
 };
 
+/*Socket of the damage mesh resolved once when a trace starts, so each frame is a bone transform instead of a lookup by name*/
+struct FACMResolvedSocket {
+    FName SocketName = NAME_None;
+
+    /*Bone of a skinned mesh the socket is attached to, INDEX_NONE when relative to the component*/
+    int32 BoneIndex = INDEX_NONE;
+
+    FTransform LocalTransform = FTransform::Identity;
+
+    bool bIsValid = false;
+
+    /*False for mesh types we can't resolve, they fall back to the lookup by name*/
+    bool bIsResolved = false;
+};
+
 USTRUCT(BlueprintType)
 struct FBaseTraceInfo {
 
@@ -287,6 +368,7 @@ public:
         StartSocket = "start";
         EndSocket = "end";
         bIsFirstFrame = true;
+        oldStartSocketPos = FVector();
         oldEndSocketPos = FVector();
         bCrossframeAccuracy = true;
     }
@@ -314,8 +396,16 @@ public:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = ACM)
     bool bCrossframeAccuracy;
 
+    /** Max sweeps per frame along the swing with Crossframe Accuracy, fast swings are split so targets between two frames are not skipped*/
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = ACM, meta = (ClampMin = 1, EditCondition = "bCrossframeAccuracy"))
+    int32 MaxSubsteps = 4;
+
     bool bIsFirstFrame;
+    FVector oldStartSocketPos;
     FVector oldEndSocketPos;
+
+    FACMResolvedSocket ResolvedStartSocket;
+    FACMResolvedSocket ResolvedEndSocket;
 };
 
 UCLASS()
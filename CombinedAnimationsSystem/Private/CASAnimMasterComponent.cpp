@@ -7,7 +7,9 @@
 #include "CASTypes.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
+#include "GameFramework/GameStateBase.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "MotionWarpingComponent.h"
 #include "Net/UnrealNetwork.h"
@@ -33,7 +35,7 @@ void UCASAnimMasterComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
     //
 
     DOREPLIFETIME(UCASAnimMasterComponent, bIsPlayingCombAnim);
-    DOREPLIFETIME(UCASAnimMasterComponent, currentAnim);
+    DOREPLIFETIME(UCASAnimMasterComponent, combinedAnimSync);
 }
 
 bool UCASAnimMasterComponent::TryPlayCombinedAnimation(ACharacter* otherCharachter, const FGameplayTag& combineAnimTag)
@@ -48,15 +50,12 @@ bool UCASAnimMasterComponent::TryPlayCombinedAnimation(ACharacter* otherCharacht
 
 void UCASAnimMasterComponent::PlayCombinedAnimation_Implementation(class ACharacter* otherCharachter, const FGameplayTag& combineAnimTag)
 {
-    const FCombinedAnimsMaster* animConfig = GetCombinedAnimTag(combineAnimTag);
+    const int32 animIndex = GetCombinedAnimIndex(combineAnimTag);
+    if (animIndex != INDEX_NONE && masterAnims[animIndex]->MasterAnimMontage && warpComponent) {
+        currentAnim = FCurrentCombinedAnim(*masterAnims[animIndex], combineAnimTag, nullptr);
+        RegisterSlave(otherCharachter);
 
-    UMotionWarpingComponent* warpComponent = characterOwner->FindComponentByClass<UMotionWarpingComponent>();
-    if (animConfig && animConfig->MasterAnimMontage && warpComponent) {
-        currentAnim = FCurrentCombinedAnim(*animConfig, combineAnimTag, otherCharachter);
-
-        StartAnim();
-
-        bIsPlayingCombAnim = true;
+        bIsPlayingCombAnim = StartAnim(animIndex);
         return;
     }
 }
@@ -92,47 +91,55 @@ bool UCASAnimMasterComponent::CanPlayCombinedAnimWithCharacter(ACharacter* other
         return false;
     }
 
-    UMotionWarpingComponent* warpComponent = characterOwner->FindComponentByClass<UMotionWarpingComponent>();
     return (animConfig->MasterAnimMontage && warpComponent);
 }
 
-void UCASAnimMasterComponent::MulticastPlayAnimMontage_Implementation(const FCurrentCombinedAnim& combinedAnim)
+void UCASAnimMasterComponent::BuildMasterAnimsTable()
 {
-    Internal_PlayMontageWithWarp(combinedAnim);
-    return;
+    masterAnims.Reset();
+    masterAnimIndices.Reset();
+    if (!MasterAnimsConfig) {
+        return;
+    }
+
+    // Rows are in the same order on every machine loading the same table
+    for (const auto& anim : MasterAnimsConfig->GetRowMap()) {
+        FCombinedAnimsMaster* currConfig = (FCombinedAnimsMaster*)anim.Value;
+        if (currConfig) {
+            const int32 index = masterAnims.Add(currConfig);
+            if (!masterAnimIndices.Contains(currConfig->AnimTag)) {
+                masterAnimIndices.Add(currConfig->AnimTag, index);
+            }
+        }
+    }
 }
 
-bool UCASAnimMasterComponent::MulticastPlayAnimMontage_Validate(const FCurrentCombinedAnim& combinedAnim)
+int32 UCASAnimMasterComponent::GetCombinedAnimIndex(const FGameplayTag& combineAnimTag) const
 {
-    return true;
+    const int32* index = masterAnimIndices.Find(combineAnimTag);
+    return index ? *index : INDEX_NONE;
 }
 
-void UCASAnimMasterComponent::MulticastSlavePlayAnimMontage_Implementation(ACharacter* slave, UAnimMontage* montage)
+FCombinedAnimsMaster* UCASAnimMasterComponent::GetCombinedAnimTag(const FGameplayTag& combineAnimTag)
 {
-    if (slave) {
-        if (characterOwner && characterOwner->GetMesh() && slave->GetMesh()) {
-            currentAnimScale = slave->GetMesh()->GlobalAnimRateScale;
-            slave->GetMesh()->GlobalAnimRateScale = characterOwner->GetMesh()->GlobalAnimRateScale;
-        }
-        slave->PlayAnimMontage(montage);
-    }
+    const int32 index = GetCombinedAnimIndex(combineAnimTag);
+    return index != INDEX_NONE ? masterAnims[index] : nullptr;
 }
 
-bool UCASAnimMasterComponent::MulticastSlavePlayAnimMontage_Validate(ACharacter* slave, UAnimMontage* montage)
+void UCASAnimMasterComponent::RegisterSlave(ACharacter* slave)
 {
-    return IsValid(slave);
+    currentAnim.AnimSlave = slave;
+    currentAnim.SlaveComponent = slave ? slave->FindComponentByClass<UCASAnimSlaveComponent>() : nullptr;
 }
 
-FCombinedAnimsMaster* UCASAnimMasterComponent::GetCombinedAnimTag(const FGameplayTag& combineAnimTag)
+float UCASAnimMasterComponent::GetServerWorldTime() const
 {
-    const auto anims = MasterAnimsConfig->GetRowMap();
-    for (const auto anim : anims) {
-        FCombinedAnimsMaster* currConfig = (FCombinedAnimsMaster*)anim.Value;
-        if (currConfig && currConfig->AnimTag == combineAnimTag) {
-            return currConfig;
-        }
+    const UWorld* world = GetWorld();
+    const AGameStateBase* gameState = world ? world->GetGameState() : nullptr;
+    if (gameState) {
+        return gameState->GetServerWorldTimeSeconds();
     }
-    return nullptr;
+    return world ? world->GetTimeSeconds() : 0.f;
 }
 
 // Called when the game starts
@@ -141,6 +148,15 @@ void UCASAnimMasterComponent::BeginPlay()
     Super::BeginPlay();
 
     characterOwner = Cast<ACharacter>(GetOwner());
+    if (characterOwner) {
+        warpComponent = characterOwner->FindComponentByClass<UMotionWarpingComponent>();
+    }
+    BuildMasterAnimsTable();
+
+    // The initial replication can arrive before BeginPlay, when the owner and the table were not ready yet
+    if (!GetOwner()->HasAuthority() && combinedAnimSync.AnimSlave) {
+        OnRep_CombinedAnimSync();
+    }
 }
 
 bool UCASAnimMasterComponent::EvaluateCombinedAnim(const FCombinedAnimsMaster& animConfig, const ACharacter* otherChar) const
@@ -192,76 +208,119 @@ void UCASAnimMasterComponent::HandleMontageFinished(UAnimMontage* inMontage, boo
                 currentAnim.AnimSlave->GetMesh()->GlobalAnimRateScale = currentAnimScale;
             }
 
-            const UCASAnimSlaveComponent* slaveComp = currentAnim.AnimSlave->FindComponentByClass<UCASAnimSlaveComponent>();
-            if (slaveComp) {
-                slaveComp->OnCombinedAnimationEnded.Broadcast(currentAnim.AnimTag);
+            if (currentAnim.SlaveComponent) {
+                currentAnim.SlaveComponent->OnCombinedAnimationEnded.Broadcast(currentAnim.AnimTag);
             }
         }
         bIsPlayingCombAnim = false;
     }
 }
 
-void UCASAnimMasterComponent::StartAnim()
+bool UCASAnimMasterComponent::StartAnim(int32 animIndex)
 {
     UAnimInstance* animinst = (characterOwner->GetMesh()->GetAnimInstance());
-    if (animinst && currentAnim.AnimSlave && currentAnim.MasterAnimConfig.MasterAnimMontage) {
-        animinst->OnMontageBlendingOut.AddDynamic(this, &UCASAnimMasterComponent::HandleMontageFinished);
-        const ACharacter* otherCharacter = currentAnim.AnimSlave;
-        const float distance = characterOwner->GetDistanceTo(otherCharacter);
-
-        const FVector otheractorLoc = otherCharacter->GetActorLocation();
-        FRotator warpRotation = UKismetMathLibrary::FindLookAtRotation(characterOwner->GetActorLocation(), otheractorLoc);
-        warpRotation.Pitch = 0.f;
-        warpRotation.Roll = 0.f;
-
-        currentAnim.WarpTransform = FTransform(warpRotation, otheractorLoc);
-        MulticastPlayAnimMontage(currentAnim);
-        StartAnimOnSlave();
-        ServerCombinedAnimationStarted.Broadcast(currentAnim.AnimTag);
-        DispatchAnimStarted(currentAnim.AnimTag);
+    if (!animinst || !currentAnim.AnimSlave || !currentAnim.SlaveComponent || !currentAnim.MasterAnimConfig.MasterAnimMontage) {
+        return false;
     }
-}
 
-void UCASAnimMasterComponent::StartAnimOnSlave()
-{
-    if (currentAnim.AnimSlave) {
-        const UCASAnimSlaveComponent* slaveComp = currentAnim.AnimSlave->FindComponentByClass<UCASAnimSlaveComponent>();
-
-        FCombinedAnimsSlave outAnim;
-        if (slaveComp->TryGetSlaveAnim(currentAnim.AnimTag, outAnim) && outAnim.MasterAnimMontage) {
-            FRotator rotation = currentAnim.AnimSlave->GetActorRotation();
-
-            switch (currentAnim.MasterAnimConfig.SlaveForcedDirection) {
-            case ERelativeDirection::EFrontal:
-                rotation = UKismetMathLibrary::FindLookAtRotation(currentAnim.AnimSlave->GetActorLocation(), characterOwner->GetActorLocation());
-                break;
-            case ERelativeDirection::EOpposite:
-                rotation = UKismetMathLibrary::FindLookAtRotation(characterOwner->GetActorLocation(), currentAnim.AnimSlave->GetActorLocation());
-                break;
-            case ERelativeDirection::EAny:
-            default:
-                break;
-            }
+    FCombinedAnimsSlave slaveAnim;
+    if (!currentAnim.SlaveComponent->TryGetSlaveAnim(currentAnim.AnimTag, slaveAnim) || !slaveAnim.MasterAnimMontage) {
+        return false;
+    }
 
-            currentAnim.AnimSlave->SetActorRotation(rotation);
+    animinst->OnMontageBlendingOut.AddDynamic(this, &UCASAnimMasterComponent::HandleMontageFinished);
+    const ACharacter* otherCharacter = currentAnim.AnimSlave;
 
-            MulticastSlavePlayAnimMontage(currentAnim.AnimSlave, outAnim.MasterAnimMontage);
-            slaveComp->OnCombinedAnimationStarted.Broadcast(currentAnim.AnimTag);
-        } else {
-            bIsPlayingCombAnim = false;
-        }
+    const FVector otheractorLoc = otherCharacter->GetActorLocation();
+    FRotator warpRotation = UKismetMathLibrary::FindLookAtRotation(characterOwner->GetActorLocation(), otheractorLoc);
+    warpRotation.Pitch = 0.f;
+    warpRotation.Roll = 0.f;
+
+    combinedAnimSync.SyncId++;
+    combinedAnimSync.AnimSlave = currentAnim.AnimSlave;
+    combinedAnimSync.MontageIndex = animIndex;
+    combinedAnimSync.StartTime = GetServerWorldTime();
+    combinedAnimSync.SetWarpTransform(FTransform(warpRotation, otheractorLoc));
+
+    // The server warps on the same quantized transform the clients receive
+    currentAnim.WarpTransform = combinedAnimSync.GetWarpTransform();
+
+    RotateSlave();
+    PlayCombinedAnimLocally(0.f);
+    ServerCombinedAnimationStarted.Broadcast(currentAnim.AnimTag);
+    currentAnim.SlaveComponent->OnCombinedAnimationStarted.Broadcast(currentAnim.AnimTag);
+    return true;
+}
+
+void UCASAnimMasterComponent::RotateSlave()
+{
+    FRotator rotation = currentAnim.AnimSlave->GetActorRotation();
+
+    switch (currentAnim.MasterAnimConfig.SlaveForcedDirection) {
+    case ERelativeDirection::EFrontal:
+        rotation = UKismetMathLibrary::FindLookAtRotation(currentAnim.AnimSlave->GetActorLocation(), characterOwner->GetActorLocation());
+        break;
+    case ERelativeDirection::EOpposite:
+        rotation = UKismetMathLibrary::FindLookAtRotation(characterOwner->GetActorLocation(), currentAnim.AnimSlave->GetActorLocation());
+        break;
+    case ERelativeDirection::EAny:
+    default:
+        break;
     }
+
+    currentAnim.AnimSlave->SetActorRotation(rotation);
 }
 
-void UCASAnimMasterComponent::DispatchAnimStarted_Implementation(const FGameplayTag& animTag)
+void UCASAnimMasterComponent::OnRep_CombinedAnimSync()
 {
-    OnCombinedAnimationStarted.Broadcast(animTag);
-    OnCombinedAnimStarted(animTag);
+    // Replayed from BeginPlay
+    if (!HasBegunPlay()) {
+        return;
+    }
+
+    if (!characterOwner || !combinedAnimSync.AnimSlave || !masterAnims.IsValidIndex(combinedAnimSync.MontageIndex)) {
+        return;
+    }
+
+    const FCombinedAnimsMaster* animConfig = masterAnims[combinedAnimSync.MontageIndex];
+    if (!animConfig->MasterAnimMontage) {
+        return;
+    }
+
+    // Late updates, e.g. the master just became relevant, resume the anim where it is on the server
+    // (the warp only applies to what is left of its window) or skip it if it's over
+    const float elapsedTime = GetServerWorldTime() - combinedAnimSync.StartTime;
+    if (elapsedTime >= animConfig->MasterAnimMontage->GetPlayLength()) {
+        return;
+    }
+
+    currentAnim = FCurrentCombinedAnim(*animConfig, animConfig->AnimTag, nullptr);
+    RegisterSlave(combinedAnimSync.AnimSlave);
+    currentAnim.WarpTransform = combinedAnimSync.GetWarpTransform();
+
+    PlayCombinedAnimLocally(FMath::Max(elapsedTime, 0.f));
 }
 
-bool UCASAnimMasterComponent::DispatchAnimStarted_Validate(const FGameplayTag& animTag)
+void UCASAnimMasterComponent::PlayCombinedAnimLocally(float startPosition)
 {
-    return true;
+    Internal_PlayMontageWithWarp(currentAnim, startPosition);
+
+    FCombinedAnimsSlave slaveAnim;
+    if (currentAnim.SlaveComponent && currentAnim.SlaveComponent->TryGetSlaveAnim(currentAnim.AnimTag, slaveAnim) && slaveAnim.MasterAnimMontage) {
+        USkeletalMeshComponent* slaveMesh = currentAnim.AnimSlave->GetMesh();
+        if (characterOwner->GetMesh() && slaveMesh) {
+            currentAnimScale = slaveMesh->GlobalAnimRateScale;
+            slaveMesh->GlobalAnimRateScale = characterOwner->GetMesh()->GlobalAnimRateScale;
+        }
+
+        UAnimInstance* slaveAnimInst = slaveMesh ? slaveMesh->GetAnimInstance() : nullptr;
+        if (slaveAnimInst) {
+            slaveAnimInst->Montage_Play(slaveAnim.MasterAnimMontage, 1.f, EMontagePlayReturnType::MontageLength, startPosition);
+        }
+    }
+
+    OnCombinedAnimationStarted.Broadcast(currentAnim.AnimTag);
+    OnCombinedAnimStarted(currentAnim.AnimTag);
 }
 
 void UCASAnimMasterComponent::DispatchAnimEnded_Implementation(const FGameplayTag& animTag)
@@ -275,23 +334,25 @@ bool UCASAnimMasterComponent::DispatchAnimEnded_Validate(const FGameplayTag& ani
     return true;
 }
 
-void UCASAnimMasterComponent::Internal_PlayMontageWithWarp(const FCurrentCombinedAnim& combinedAnim)
+void UCASAnimMasterComponent::Internal_PlayMontageWithWarp(const FCurrentCombinedAnim& combinedAnim, float startPosition)
 {
-    if (!characterOwner) {
+    if (!characterOwner || !warpComponent) {
         return;
     }
 
-    UMotionWarpingComponent* motionComp = characterOwner->FindComponentByClass<UMotionWarpingComponent>();
-
     const FMotionWarpingTarget newTarget = FMotionWarpingTarget(WarpSyncPoint, combinedAnim.WarpTransform);
-    motionComp->AddOrUpdateWarpTarget(newTarget);
+    warpComponent->AddOrUpdateWarpTarget(newTarget);
 
-    URootMotionModifier_SkewWarp::AddRootMotionModifierSkewWarp(motionComp, combinedAnim.MasterAnimConfig.MasterAnimMontage,
+    URootMotionModifier_SkewWarp::AddRootMotionModifierSkewWarp(warpComponent, combinedAnim.MasterAnimConfig.MasterAnimMontage,
         0.0f,
         combinedAnim.MasterAnimConfig.WarpTime, WarpSyncPoint,
         EWarpPointAnimProvider::None, currentAnim.WarpTransform, NAME_None, true, true, true,
         EMotionWarpRotationType::Facing, EMotionWarpRotationMethod::Slerp, combinedAnim.MasterAnimConfig.WarpRotationTimeMultiplier);
-    characterOwner->PlayAnimMontage(combinedAnim.MasterAnimConfig.MasterAnimMontage);
+
+    UAnimInstance* animinst = characterOwner->GetMesh() ? characterOwner->GetMesh()->GetAnimInstance() : nullptr;
+    if (animinst) {
+        animinst->Montage_Play(combinedAnim.MasterAnimConfig.MasterAnimMontage, 1.f, EMontagePlayReturnType::MontageLength, startPosition);
+    }
 }
 
 FVector UCASAnimMasterComponent::GetPointAtDirectionAndDistanceFromActor(const AActor* targetActor, const FVector& direction, float distance, bool bShowDebug /*= false*/)
@@ -2,7 +2,44 @@
 
 
 #include "CASTypes.h"
+#include "UObject/CoreNet.h"
 
+void FCASCombinedAnimSync::SetWarpTransform(const FTransform& warpTransform)
+{
+    WarpOffset = AnimSlave ? warpTransform.GetLocation() - AnimSlave->GetActorLocation() : warpTransform.GetLocation();
+    WarpYaw = FRotator::CompressAxisToShort(warpTransform.Rotator().Yaw);
+}
 
+FTransform FCASCombinedAnimSync::GetWarpTransform() const
+{
+    // Rebuilt from the local slave, the warp follows where the slave is on this machine
+    const FVector location = AnimSlave ? AnimSlave->GetActorLocation() + WarpOffset : FVector(WarpOffset);
+    return FTransform(FRotator(0.f, FRotator::DecompressAxisFromShort(WarpYaw), 0.f), location);
+}
 
+bool FCASCombinedAnimSync::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << SyncId;
 
+    UObject* slave = AnimSlave;
+    bOutSuccess = Map->SerializeObject(Ar, ACharacter::StaticClass(), slave);
+    if (Ar.IsLoading()) {
+        AnimSlave = Cast<ACharacter>(slave);
+    }
+
+    // Stored shifted by one so INDEX_NONE packs in a single byte
+    uint32 packedIndex = uint32(MontageIndex + 1);
+    Ar.SerializeIntPacked(packedIndex);
+    if (Ar.IsLoading()) {
+        MontageIndex = int32(packedIndex) - 1;
+    }
+
+    Ar << StartTime;
+
+    bool bOffsetSuccess = true;
+    WarpOffset.NetSerialize(Ar, Map, bOffsetSuccess);
+    bOutSuccess &= bOffsetSuccess;
+
+    Ar << WarpYaw;
+    return true;
+}
@@ -77,38 +77,56 @@ protected:
 	virtual void OnCombinedAnimStarted(const FGameplayTag& animTag);
 	virtual void OnCombinedAnimEnded(const FGameplayTag& animTag);
 
-	UPROPERTY(Replicated)
+	/*Local on every machine, clients rebuild it from the replicated sync state*/
+	UPROPERTY()
 	FCurrentCombinedAnim currentAnim;
 
 	TObjectPtr<class ACharacter> characterOwner;
 
+	TObjectPtr<class UMotionWarpingComponent> warpComponent;
+
 	float currentAnimScale;
 private:
 	UPROPERTY(Replicated)
 	bool bIsPlayingCombAnim = false;
 
+	/*Replaces the multicasts of the master and slave montages, clients start the anim when it changes*/
+	UPROPERTY(ReplicatedUsing = OnRep_CombinedAnimSync)
+	FCASCombinedAnimSync combinedAnimSync;
+
+	/*Rows of MasterAnimsConfig, the index of a row is what gets replicated*/
+	TArray<FCombinedAnimsMaster*> masterAnims;
+	TMap<FGameplayTag, int32> masterAnimIndices;
+
+	void BuildMasterAnimsTable();
+
+	int32 GetCombinedAnimIndex(const FGameplayTag& combineAnimTag) const;
 
 	FCombinedAnimsMaster* GetCombinedAnimTag(const FGameplayTag& combineAnimTag);
+
+	/*Sets the slave of currentAnim, caching its components*/
+	void RegisterSlave(ACharacter* slave);
+
+	float GetServerWorldTime() const;
+
 	UFUNCTION()
 	void HandleMontageFinished(UAnimMontage* inMontage, bool bInterruptted);
 
-	void StartAnim();
+	bool StartAnim(int32 animIndex);
 
-	void StartAnimOnSlave();
+	void RotateSlave();
 
-	FVector GetPointAtDirectionAndDistanceFromActor(const AActor* targetActor, const FVector& direction, float distance, bool bShowDebug /*= false*/);
-	UFUNCTION(NetMulticast, Reliable, WithValidation, Category = CAS)
-	void MulticastPlayAnimMontage(const FCurrentCombinedAnim& combinedAnim);
+	UFUNCTION()
+	void OnRep_CombinedAnimSync();
 
-	UFUNCTION(NetMulticast, Reliable, WithValidation, Category = CAS)
-	void MulticastSlavePlayAnimMontage(ACharacter* slave, UAnimMontage* montage);
+	/*Plays the current anim on master and slave and dispatches its start locally*/
+	void PlayCombinedAnimLocally(float startPosition);
 
-	UFUNCTION(NetMulticast, Reliable, WithValidation, Category = CAS)
-	void DispatchAnimStarted(const FGameplayTag& animTag);
+	FVector GetPointAtDirectionAndDistanceFromActor(const AActor* targetActor, const FVector& direction, float distance, bool bShowDebug /*= false*/);
 
 	UFUNCTION(NetMulticast, Reliable, WithValidation, Category = CAS)
 	void DispatchAnimEnded(const FGameplayTag& animTag);
 
-	void Internal_PlayMontageWithWarp(const FCurrentCombinedAnim& combinedAnim);
+	void Internal_PlayMontageWithWarp(const FCurrentCombinedAnim& combinedAnim, float startPosition);
 
 };
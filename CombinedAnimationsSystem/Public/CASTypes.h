@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "Engine/NetSerialization.h"
 #include "GameplayTagContainer.h"
 #include "UObject/NoExportTypes.h"
 #include <GameFramework/Character.h>
@@ -95,6 +96,7 @@ public:
     {
 
         AnimSlave = nullptr;
+        SlaveComponent = nullptr;
     };
 
     FCurrentCombinedAnim(const FCombinedAnimsMaster& inMasterConfig, const FGameplayTag& inTag, ACharacter* inCharacterRef)
@@ -102,6 +104,7 @@ public:
         MasterAnimConfig = inMasterConfig;
         AnimTag = inTag;
         AnimSlave = inCharacterRef;
+        SlaveComponent = nullptr;
     }
     UPROPERTY(BlueprintReadOnly, Category = "CAS")
     FTransform WarpTransform;
@@ -114,6 +117,52 @@ public:
 
     UPROPERTY(BlueprintReadOnly, Category = "CAS")
     ACharacter* AnimSlave;
+
+    /*Cached when the slave is registered in this anim*/
+    UPROPERTY(BlueprintReadOnly, Category = "CAS")
+    class UCASAnimSlaveComponent* SlaveComponent;
+};
+
+/*Replicated state of the combined anim started by a master. Each start bumps SyncId, so clients play
+the anim again even if all the other fields are unchanged*/
+USTRUCT()
+struct FCASCombinedAnimSync {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    uint8 SyncId = 0;
+
+    UPROPERTY()
+    ACharacter* AnimSlave = nullptr;
+
+    /*Row of the anim in the master anims table, INDEX_NONE if no anim was started*/
+    UPROPERTY()
+    int32 MontageIndex = INDEX_NONE;
+
+    /*Server world time of the start*/
+    UPROPERTY()
+    float StartTime = 0.f;
+
+    /*Warp location relative to the slave and warp yaw, pitch and roll are always 0*/
+    UPROPERTY()
+    FVector_NetQuantize10 WarpOffset = FVector::ZeroVector;
+
+    UPROPERTY()
+    uint16 WarpYaw = 0;
+
+    void SetWarpTransform(const FTransform& warpTransform);
+
+    FTransform GetWarpTransform() const;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FCASCombinedAnimSync> : public TStructOpsTypeTraitsBase2<FCASCombinedAnimSync> {
+    enum {
+        WithNetSerializer = true,
+    };
 };
 /**
  *
@@ -1260,6 +1260,25 @@ void UACFEquipmentComponent::InitializeStartingItems()
     }
 }
 
+void UACFEquipmentComponent::ResetEquipment()
+{
+    if (!GetOwner()->HasAuthority()) {
+        return;
+    }
+
+    // Unequipping removes the item from the equipment, so iterate on a copy of the slots
+    TArray<FGameplayTag> equippedSlots;
+    for (const FEquippedItem& equip : Equipment.EquippedItems) {
+        equippedSlots.Add(equip.GetItemSlot());
+    }
+    for (const FGameplayTag& slot : equippedSlots) {
+        UnequipItemBySlot(slot);
+    }
+
+    Inventory.Empty();
+    currentInventoryWeight = 0.f;
+}
+
 void UACFEquipmentComponent::SpawnWorldItem(const TArray<FBaseItem>& items)
 {
     if (CharacterOwner) {
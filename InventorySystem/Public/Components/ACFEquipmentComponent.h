@@ -215,6 +215,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = ACF)
     void InitializeStartingItems();
 
+    /* Use this only on Server!!!
+     *
+     *Unequips and destroys every equipped item and empties the inventory, so that
+     * InitializeStartingItems can be called again on a recycled character
+     */
+    UFUNCTION(BlueprintCallable, Category = ACF)
+    void ResetEquipment();
+
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = ACF)
     void OnEntityOwnerDeath();
 
@@ -1,15 +1,12 @@
 #include "ACFStealthDetectionComponent.h"
 #include "ACFAIController.h"
 #include "Components/ACFThreatManagerComponent.h"
-#include "Components/LightComponent.h"
-#include "Components/PointLightComponent.h"
-#include "Components/SpotLightComponent.h"
 #include "Game/ACFFunctionLibrary.h"
 #include "GameFramework/Pawn.h"
 #include "Interfaces/ACFEntityInterface.h"
-#include "Kismet/GameplayStatics.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "PortalStealthConfigDataAsset.h"
+#include "PortalStealthContextSubsystem.h"
 
 UACFStealthDetectionComponent::UACFStealthDetectionComponent()
 {
@@ -47,6 +44,33 @@ void UACFStealthDetectionComponent::BeginPlay()
     }
 
     InitializeWithACFController();
+
+    StealthContext = UPortalStealthContextSubsystem::GetInstance(this);
+    if (StealthContext) {
+        StealthContext->RegisterGuard(this);
+    }
+}
+
+void UACFStealthDetectionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (StealthContext) {
+        StealthContext->UnregisterGuard(this);
+        StealthContext = nullptr;
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+APawn* UACFStealthDetectionComponent::GetGuardPawn() const
+{
+    if (OwnerPawn) {
+        return OwnerPawn;
+    }
+
+    if (const AController* OwnerController = Cast<AController>(GetOwner())) {
+        return OwnerController->GetPawn();
+    }
+    return nullptr;
 }
 
 void UACFStealthDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -105,8 +129,11 @@ bool UACFStealthDetectionComponent::PerformStealthDetection(APawn* TargetPlayer,
 
     float DistanceToPlayer = FVector::Dist(OwnerPawn->GetActorLocation(), TargetPlayer->GetActorLocation());
 
+    // Illumination is resolved once and shared by both priorities
+    const bool bPlayerIlluminated = IsPlayerIlluminated(TargetPlayer);
+
     // PRIORITY 1: Light Detection (Instant Aggro)
-    if (StealthSettings.bInstantAggroInLight && IsPlayerIlluminated(TargetPlayer)) {
+    if (StealthSettings.bInstantAggroInLight && bPlayerIlluminated) {
         if (DistanceToPlayer <= StealthSettings.LightAggroRange && HasLineOfSightToPlayer(TargetPlayer)) {
             OutDetectionRange = StealthSettings.LightAggroRange;
             OutDetectionType = EStealthDetectionType::LightAggro;
@@ -115,7 +142,7 @@ bool UACFStealthDetectionComponent::PerformStealthDetection(APawn* TargetPlayer,
     }
 
     // PRIORITY 2: Darkness Detection
-    if (ShouldUseDarknessDetection(TargetPlayer)) {
+    if (!bPlayerIlluminated) {
         // Audio Detection
         if (CanHearPlayer(TargetPlayer)) {
             OutDetectionRange = CalculatePlayerNoiseLevel(TargetPlayer);
@@ -138,40 +165,10 @@ bool UACFStealthDetectionComponent::PerformStealthDetection(APawn* TargetPlayer,
 
 bool UACFStealthDetectionComponent::IsPlayerIlluminated(APawn* Player)
 {
-    if (!Player)
+    if (!Player || !StealthContext)
         return false;
 
-    FVector PlayerLocation = Player->GetActorLocation();
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), AllActors);
-
-    for (AActor* Actor : AllActors) {
-        TArray<ULightComponent*> LightComponents;
-        Actor->GetComponents<ULightComponent>(LightComponents);
-
-        for (ULightComponent* LightComp : LightComponents) {
-            if (LightComp && LightComp->IsVisible()) {
-                float DistanceToLight = FVector::Dist(PlayerLocation, Actor->GetActorLocation());
-                float LightRadius = StealthSettings.LightDetectionRadius;
-
-                if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(LightComp)) {
-                    LightRadius = PointLight->AttenuationRadius;
-                } else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(LightComp)) {
-                    LightRadius = SpotLight->AttenuationRadius;
-                }
-
-                if (LightRadius <= 0.0f) {
-                    LightRadius = StealthSettings.LightDetectionRadius;
-                }
-
-                if (DistanceToLight <= FMath::Min(LightRadius, StealthSettings.LightDetectionRadius)) {
-                    return true;
-                }
-            }
-        }
-    }
-
-    return false;
+    return StealthContext->IsPointIlluminated(Player->GetActorLocation(), StealthSettings.LightDetectionRadius);
 }
 
 bool UACFStealthDetectionComponent::CanHearPlayer(APawn* Player)
@@ -218,36 +215,12 @@ float UACFStealthDetectionComponent::CalculatePlayerNoiseLevel(APawn* Player)
 
 bool UACFStealthDetectionComponent::IsPlayerInVegetation(APawn* Player)
 {
-    if (!Player)
+    if (!Player || !StealthContext)
         return false;
 
-    FVector PlayerLocation = Player->GetActorLocation();
-
-    for (const FName& Tag : VegetationTags) {
-        TArray<AActor*> VegetationActors;
-        UGameplayStatics::GetAllActorsWithTag(GetWorld(), Tag, VegetationActors);
-
-        for (AActor* VegActor : VegetationActors) {
-            float Distance = FVector::Dist(PlayerLocation, VegActor->GetActorLocation());
-            if (Distance < 200.0f) {
-                return true;
-            }
-        }
-    }
-
-    for (const FName& Tag : GrassTags) {
-        TArray<AActor*> GrassActors;
-        UGameplayStatics::GetAllActorsWithTag(GetWorld(), Tag, GrassActors);
-
-        for (AActor* GrassActor : GrassActors) {
-            float Distance = FVector::Dist(PlayerLocation, GrassActor->GetActorLocation());
-            if (Distance < 150.0f) {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    const FVector PlayerLocation = Player->GetActorLocation();
+    return StealthContext->IsPointInCover(PlayerLocation, VegetationTags, 200.0f)
+        || StealthContext->IsPointInCover(PlayerLocation, GrassTags, 150.0f);
 }
 
 bool UACFStealthDetectionComponent::ShouldUseDarknessDetection(APawn* Player)
@@ -282,22 +255,19 @@ void UACFStealthDetectionComponent::AlertNearbyGuards(APawn* Player)
     if (!Player)
         return;
 
+    APawn* GuardPawn = GetGuardPawn();
+    if (!GuardPawn || !StealthContext)
+        return;
+
     FVector PlayerLocation = Player->GetActorLocation();
-    TArray<AActor*> NearbyActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), NearbyActors);
-
-    for (AActor* Actor : NearbyActors) {
-        if (APawn* OtherPawn = Cast<APawn>(Actor)) {
-            if (OtherPawn == OwnerPawn || OtherPawn == Player)
-                continue;
-
-            float Distance = FVector::Dist(OwnerPawn->GetActorLocation(), OtherPawn->GetActorLocation());
-            if (Distance <= StealthSettings.AggroAlertRadius) {
-                if (UACFStealthDetectionComponent* OtherStealth = OtherPawn->FindComponentByClass<UACFStealthDetectionComponent>()) {
-                    OtherStealth->StartSoundInvestigation(PlayerLocation);
-                }
-            }
-        }
+    TArray<UACFStealthDetectionComponent*> NearbyGuards;
+    StealthContext->GetGuardsInRadius(GuardPawn->GetActorLocation(), StealthSettings.AggroAlertRadius, NearbyGuards);
+
+    for (UACFStealthDetectionComponent* OtherStealth : NearbyGuards) {
+        if (OtherStealth == this || OtherStealth->GetGuardPawn() == Player)
+            continue;
+
+        OtherStealth->StartSoundInvestigation(PlayerLocation);
     }
 }
 
@@ -347,8 +317,11 @@ void UACFStealthDetectionComponent::CheckForStealthThreats()
     if (!ACFController || !OwnerPawn)
         return;
 
-    TArray<AActor*> FoundActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), FoundActors);
+    if (!StealthContext)
+        return;
+
+    TArray<APawn*> PlayerPawns;
+    StealthContext->GetPlayerPawns(PlayerPawns);
 
     APawn* DetectedPlayerTarget = nullptr;
     float NearestDistance = FLT_MAX;
@@ -356,9 +329,8 @@ void UACFStealthDetectionComponent::CheckForStealthThreats()
 
     PlayersInHearingRange.Empty();
 
-    for (AActor* Actor : FoundActors) {
-        APawn* PlayerPawn = Cast<APawn>(Actor);
-        if (!PlayerPawn || PlayerPawn == OwnerPawn || !PlayerPawn->IsPlayerControlled()) {
+    for (APawn* PlayerPawn : PlayerPawns) {
+        if (!PlayerPawn || PlayerPawn == OwnerPawn) {
             continue;
         }
 
@@ -8,6 +8,7 @@
 #include "ACFStealthDetectionComponent.generated.h"
 
 class UPortalStealthConfigDataAsset;
+class UPortalStealthContextSubsystem;
 class ULightComponent;
 class UPointLightComponent;
 class USpotLightComponent;
@@ -90,6 +91,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -143,6 +145,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Stealth Detection")
     FHybridStealthSettings GetStealthSettings() const { return StealthSettings; }
 
+    // Pawn this guard perceives from, whether the component lives on the pawn or on its controller
+    UFUNCTION(BlueprintPure, Category = "Stealth Detection")
+    APawn* GetGuardPawn() const;
+
 protected:
     // Configuration
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stealth Configuration")
@@ -184,6 +190,9 @@ protected:
 private:
     FTimerHandle SoundInvestigationTimer;
 
+    UPROPERTY()
+    TObjectPtr<UPortalStealthContextSubsystem> StealthContext;
+
     // Bound to ACF AI Controller's perception system
     UFUNCTION()
     void OnACFPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus);
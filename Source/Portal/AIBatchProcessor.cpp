@@ -2,6 +2,7 @@
 
 #include "AIBatchProcessor.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
 #include "GameFramework/GameModeBase.h"
@@ -22,6 +23,10 @@ UAIBatchProcessor::UAIBatchProcessor()
     BatchSettings.StandardBatchUpdateRate = 0.5f;
     BatchSettings.HighBatchUpdateRate = 0.1f;
     BatchSettings.MaximumBatchUpdateRate = 0.0f; // Every tick
+    BatchSettings.MinimalFrameBudgetMs = 0.25f;
+    BatchSettings.StandardFrameBudgetMs = 0.5f;
+    BatchSettings.HighFrameBudgetMs = 1.0f;
+    BatchSettings.MaximumFrameBudgetMs = 2.0f;
     BatchSettings.bUseAsyncProcessing = true;
     BatchSettings.bEnablePerformanceScaling = true;
 
@@ -41,14 +46,12 @@ void UAIBatchProcessor::BeginPlay()
         UE_LOG(LogTemp, Warning, TEXT("AIBatchProcessor: Could not find LOD Manager instance"));
     }
 
-    InitializeBatchTimers();
-
     UE_LOG(LogTemp, Log, TEXT("AI Batch Processor initialized - Max AI per batch: %d"), BatchSettings.MaxAIPerBatch);
 }
 
 void UAIBatchProcessor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    ClearBatchTimers();
+    ResetFrameBuffers();
 
     if (InstancePtr == this) {
         InstancePtr = nullptr;
@@ -63,16 +66,28 @@ void UAIBatchProcessor::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 
     LastFrameTime = DeltaTime * 1000.0f; // Convert to milliseconds
 
-    // Process Maximum LOD AI every tick
-    ProcessMaximumBatch();
-
     // Update batches periodically
-    static float BatchUpdateTimer = 0.0f;
     BatchUpdateTimer += DeltaTime;
     if (BatchUpdateTimer >= 1.0f) {
         UpdateBatches();
         BatchUpdateTimer = 0.0f;
     }
+
+    // Gather every LOD batch that is due, then compute them all in one parallel pass
+    ResetFrameBuffers();
+
+    for (int32 LODIndex = static_cast<int32>(EAILODLevel::Minimal); LODIndex <= static_cast<int32>(EAILODLevel::Maximum); ++LODIndex) {
+        const EAILODLevel LODLevel = static_cast<EAILODLevel>(LODIndex);
+
+        BatchAccumulators[LODIndex] += DeltaTime;
+        if (BatchAccumulators[LODIndex] >= GetUpdateRate(LODLevel)) {
+            BatchAccumulators[LODIndex] = 0.0f;
+            GatherBatch(LODLevel);
+        }
+    }
+
+    ComputeBatches();
+    ApplyBatches();
 }
 
 UAIBatchProcessor* UAIBatchProcessor::GetInstance(UWorld* World)
@@ -108,12 +123,12 @@ void UAIBatchProcessor::UpdateBatches()
     // Clear current batches
     CurrentBatches = FAIBatchData();
 
-    // Reorganize AI into batches based on LOD level
+    // Reorganize AI into batches based on LOD level. Batches start empty, so no cross-batch removal is needed.
     TArray<FAILODData> AIData = LODManager->GetCurrentLODData();
 
     for (const FAILODData& Data : AIData) {
         if (Data.AIController && IsValid(Data.AIController)) {
-            AddAIToBatch(Data.AIController, Data.CurrentLODLevel);
+            GetBatchByLOD(Data.CurrentLODLevel).Add(Data.AIController);
         }
     }
 
@@ -123,71 +138,10 @@ void UAIBatchProcessor::UpdateBatches()
 
 void UAIBatchProcessor::ProcessBatch(EAILODLevel LODLevel)
 {
-    const double StartTime = FPlatformTime::Seconds();
-
-    TArray<TObjectPtr<AACFAIController>>& Batch = GetBatchByLOD(LODLevel);
-
-    if (Batch.Num() == 0) {
-        return;
-    }
-
-    const int32 MaxProcessPerFrame = FMath::Min(BatchSettings.MaxAIPerBatch, Batch.Num());
-    int32 ProcessedCount = 0;
-
-    // Get starting index for this LOD level
-    int32& CurrentIndex = (LODLevel == EAILODLevel::Inactive) ? CurrentInactiveBatchIndex : (LODLevel == EAILODLevel::Minimal) ? CurrentMinimalBatchIndex
-        : (LODLevel == EAILODLevel::Standard)                                                                                  ? CurrentStandardBatchIndex
-                                                                                                                               : CurrentHighBatchIndex;
-
-    // Process batch starting from current index
-    for (int32 i = 0; i < MaxProcessPerFrame && Batch.Num() > 0; ++i) {
-        if (CurrentIndex >= Batch.Num()) {
-            CurrentIndex = 0; // Wrap around
-        }
-
-        if (Batch.IsValidIndex(CurrentIndex)) {
-            TObjectPtr<AACFAIController> AIController = Batch[CurrentIndex];
-
-            if (AIController && IsValid(AIController)) {
-                if (APortalDefenseAIController* PortalAI = Cast<APortalDefenseAIController>(AIController)) {
-                    // Process different types of updates based on LOD level
-                    switch (LODLevel) {
-                    case EAILODLevel::Inactive:
-                        // Minimal processing for inactive AI
-                        break;
-                    case EAILODLevel::Minimal:
-                        PortalAI->UpdatePatrolLogic();
-                        break;
-                    case EAILODLevel::Standard:
-                        PortalAI->UpdatePatrolLogic();
-                        PortalAI->Tick(LastFrameTime / 1000.0f); // Convert back to seconds
-                        break;
-                    case EAILODLevel::High:
-                        PortalAI->UpdatePatrolLogic();
-                        PortalAI->Tick(LastFrameTime / 1000.0f);
-                        PortalAI->UpdateCombatBehavior();
-                        break;
-                    case EAILODLevel::Maximum:
-                        // Full processing handled in ProcessMaximumBatch
-                        break;
-                    }
-                }
-                ProcessedCount++;
-            } else {
-                // Remove invalid AI from batch
-                Batch.RemoveAt(CurrentIndex);
-                continue;
-            }
-        }
-
-        CurrentIndex++;
-    }
-
-    const double EndTime = FPlatformTime::Seconds();
-    const float ProcessingTime = (EndTime - StartTime) * 1000.0f; // Convert to milliseconds
-
-    UpdateProcessingMetrics(ProcessingTime);
-    OnBatchProcessed.Broadcast(LODLevel, ProcessedCount);
+    ResetFrameBuffers();
+    GatherBatch(LODLevel);
+    ComputeBatches();
+    ApplyBatches();
 }
 
 void UAIBatchProcessor::AddAIToBatch(AACFAIController* AIController, EAILODLevel LODLevel)
@@ -219,58 +173,23 @@ void UAIBatchProcessor::RemoveAIFromBatch(AACFAIController* AIController, EAILOD
     Batch.Remove(AIController);
 }
 
-void UAIBatchProcessor::ProcessBatchAsync(EAILODLevel LODLevel)
+void UAIBatchProcessor::RemoveAIFromAllBatches(AACFAIController* AIController)
 {
-    if (!BatchSettings.bUseAsyncProcessing) {
-        ProcessBatch(LODLevel);
-        return;
-    }
-
-    TArray<TObjectPtr<AACFAIController>>& Batch = GetBatchByLOD(LODLevel);
-
-    if (Batch.Num() == 0) {
+    if (!AIController) {
         return;
     }
 
-    // Create a copy for async processing
-    TArray<TWeakObjectPtr<AACFAIController>> BatchCopy;
-    for (const TObjectPtr<AACFAIController>& AI : Batch) {
-        if (AI && IsValid(AI)) {
-            BatchCopy.Add(AI);
-        }
-    }
-
-    // Process asynchronously for non-critical LOD levels
-    if (LODLevel == EAILODLevel::Inactive || LODLevel == EAILODLevel::Minimal) {
-        // Use task graph for async processing
-        FFunctionGraphTask::CreateAndDispatchWhenReady([this, BatchCopy, LODLevel]() {
-            const double StartTime = FPlatformTime::Seconds();
-
-            for (const TWeakObjectPtr<AACFAIController>& WeakAI : BatchCopy) {
-                if (AACFAIController* AIController = WeakAI.Get()) {
-                    if (APortalDefenseAIController* PortalAI = Cast<APortalDefenseAIController>(AIController)) {
-                        if (LODLevel == EAILODLevel::Minimal) {
-                            PortalAI->UpdatePatrolLogic();
-                        }
-                    }
-                }
-            }
+    CurrentBatches.InactiveBatch.Remove(AIController);
+    CurrentBatches.MinimalBatch.Remove(AIController);
+    CurrentBatches.StandardBatch.Remove(AIController);
+    CurrentBatches.HighBatch.Remove(AIController);
+    CurrentBatches.MaximumBatch.Remove(AIController);
+}
 
-            const double EndTime = FPlatformTime::Seconds();
-            const float ProcessingTime = (EndTime - StartTime) * 1000.0f;
-
-            // Update metrics on game thread
-            FFunctionGraphTask::CreateAndDispatchWhenReady([this, ProcessingTime, LODLevel, BatchCopy]() {
-                UpdateProcessingMetrics(ProcessingTime);
-                OnBatchProcessed.Broadcast(LODLevel, BatchCopy.Num());
-            },
-                TStatId(), nullptr, ENamedThreads::GameThread);
-        },
-            TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
-    } else {
-        // Process synchronously for critical LOD levels
-        ProcessBatch(LODLevel);
-    }
+void UAIBatchProcessor::ProcessBatchAsync(EAILODLevel LODLevel)
+{
+    // UObjects are only ever touched on the game thread; ComputeBatches is the part that fans out
+    ProcessBatch(LODLevel);
 }
 
 void UAIBatchProcessor::AdjustBatchSizes()
@@ -300,26 +219,21 @@ void UAIBatchProcessor::OptimizeBatchScheduling()
         EAILODLevel::Maximum
     };
 
+    // Priority lookup built once instead of scanning the LOD data inside every comparison
+    TMap<TObjectPtr<AACFAIController>, float> Priorities;
+    if (LODManager) {
+        for (const FAILODData& Data : LODManager->GetCurrentLODData()) {
+            Priorities.Add(Data.AIController, Data.LODPriority);
+        }
+    }
+
     for (EAILODLevel LODLevel : LODLevels) {
         TArray<TObjectPtr<AACFAIController>>& Batch = GetBatchByLOD(LODLevel);
 
         // Sort AI by priority if LOD Manager is available
         if (LODManager) {
-            TArray<FAILODData> LODData = LODManager->GetCurrentLODData();
-
-            Batch.Sort([&LODData](const TObjectPtr<AACFAIController>& A, const TObjectPtr<AACFAIController>& B) {
-                float PriorityA = 1.0f;
-                float PriorityB = 1.0f;
-
-                for (const FAILODData& Data : LODData) {
-                    if (Data.AIController == A) {
-                        PriorityA = Data.LODPriority;
-                    } else if (Data.AIController == B) {
-                        PriorityB = Data.LODPriority;
-                    }
-                }
-
-                return PriorityA > PriorityB;
+            Batch.Sort([&Priorities](const TObjectPtr<AACFAIController>& A, const TObjectPtr<AACFAIController>& B) {
+                return Priorities.FindRef(A, 1.0f) > Priorities.FindRef(B, 1.0f);
             });
         }
     }
@@ -339,83 +253,173 @@ int32 UAIBatchProcessor::GetBatchSize(EAILODLevel LODLevel) const
     return Batch.Num();
 }
 
-void UAIBatchProcessor::InitializeBatchTimers()
+void UAIBatchProcessor::ResetFrameBuffers()
 {
-    if (!GetWorld()) {
+    Snapshots.Reset();
+    Results.Reset();
+    SnapshotControllers.Reset();
+    SnapshotBatchOffsets.Reset();
+    Slices.Reset();
+}
+
+void UAIBatchProcessor::GatherBatch(EAILODLevel LODLevel)
+{
+    // Inactive AI get no batched update at all
+    if (LODLevel == EAILODLevel::Inactive) {
         return;
     }
 
-    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    TArray<TObjectPtr<AACFAIController>>& Batch = GetBatchByLOD(LODLevel);
+    if (Batch.Num() == 0) {
+        return;
+    }
 
-    // Set up timers for different batch types
-    TimerManager.SetTimer(InactiveBatchTimer, this, &UAIBatchProcessor::ProcessInactiveBatch,
-        BatchSettings.InactiveBatchUpdateRate, true);
+    const double StartTime = FPlatformTime::Seconds();
+    // Half of the budget goes to gathering, the rest is left for the apply phase
+    const double GatherBudget = GetFrameBudgetMs(LODLevel) * 0.0005;
+
+    // Maximum LOD is capped by the LOD manager and always processed in full
+    const int32 MaxGather = (LODLevel == EAILODLevel::Maximum) ? Batch.Num() : FMath::Min(BatchSettings.MaxAIPerBatch, Batch.Num());
+    int32& Cursor = BatchCursors[static_cast<int32>(LODLevel)];
+
+    FBatchSlice& Slice = Slices.AddDefaulted_GetRef();
+    Slice.LODLevel = LODLevel;
+    Slice.Start = Snapshots.Num();
+
+    Cursor %= Batch.Num(); // Wrap around
+
+    int32 Visited = 0;
+    while (Visited < MaxGather) {
+        const int32 BatchIndex = (Cursor + Visited) % Batch.Num();
+        APortalDefenseAIController* PortalAI = Cast<APortalDefenseAIController>(Batch[BatchIndex]);
+        Visited++;
+        if (!PortalAI || !IsValid(PortalAI)) {
+            continue;
+        }
 
-    TimerManager.SetTimer(MinimalBatchTimer, this, &UAIBatchProcessor::ProcessMinimalBatch,
-        BatchSettings.MinimalBatchUpdateRate, true);
+        PortalAI->GatherBatchSnapshot(Snapshots.AddDefaulted_GetRef());
+        SnapshotControllers.Add(PortalAI);
+        SnapshotBatchOffsets.Add(Visited - 1);
 
-    TimerManager.SetTimer(StandardBatchTimer, this, &UAIBatchProcessor::ProcessStandardBatch,
-        BatchSettings.StandardBatchUpdateRate, true);
+        if (LODLevel != EAILODLevel::Maximum && FPlatformTime::Seconds() - StartTime > GatherBudget) {
+            break;
+        }
+    }
 
-    TimerManager.SetTimer(HighBatchTimer, this, &UAIBatchProcessor::ProcessHighBatch,
-        BatchSettings.HighBatchUpdateRate, true);
+    Slice.Num = Snapshots.Num() - Slice.Start;
+    Slice.BatchNum = Visited;
+    Slice.GatherTime = FPlatformTime::Seconds() - StartTime;
 }
 
-void UAIBatchProcessor::ClearBatchTimers()
+void UAIBatchProcessor::ComputeBatches()
 {
-    if (!GetWorld()) {
+    if (Snapshots.Num() == 0) {
         return;
     }
 
-    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    Results.SetNum(Snapshots.Num());
 
-    TimerManager.ClearTimer(InactiveBatchTimer);
-    TimerManager.ClearTimer(MinimalBatchTimer);
-    TimerManager.ClearTimer(StandardBatchTimer);
-    TimerManager.ClearTimer(HighBatchTimer);
+    // Pure function over plain data: no UObject access, so every snapshot is independent
+    ParallelFor(Snapshots.Num(), [this](int32 Index) {
+        ComputeGuardUpdate(Snapshots[Index], Results[Index]);
+    },
+        BatchSettings.bUseAsyncProcessing ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
 }
 
-void UAIBatchProcessor::ProcessInactiveBatch()
+void UAIBatchProcessor::ApplyBatches()
 {
-    ProcessBatchAsync(EAILODLevel::Inactive);
-}
+    for (const FBatchSlice& Slice : Slices) {
+        const double StartTime = FPlatformTime::Seconds();
+        const double ApplyBudget = GetFrameBudgetMs(Slice.LODLevel) * 0.001 - Slice.GatherTime;
+        const bool bUpdateCombat = Slice.LODLevel >= EAILODLevel::High;
+
+        int32 AppliedCount = 0;
+        int32 CursorAdvance = Slice.BatchNum;
+        for (int32 Index = Slice.Start; Index < Slice.Start + Slice.Num; ++Index) {
+            // Out of budget: the rest keep their state and are picked up by the next slice
+            if (Slice.LODLevel != EAILODLevel::Maximum && AppliedCount > 0 && FPlatformTime::Seconds() - StartTime > ApplyBudget) {
+                CursorAdvance = SnapshotBatchOffsets[Index];
+                break;
+            }
 
-void UAIBatchProcessor::ProcessMinimalBatch()
-{
-    ProcessBatchAsync(EAILODLevel::Minimal);
+            if (APortalDefenseAIController* PortalAI = SnapshotControllers[Index].Get()) {
+                PortalAI->ApplyBatchResult(Results[Index], bUpdateCombat);
+            }
+            AppliedCount++;
+        }
+
+        // Advance over every visited entry, skipped invalid ones included, so the cursor never drifts
+        BatchCursors[static_cast<int32>(Slice.LODLevel)] += CursorAdvance;
+
+        const float ProcessingTime = (Slice.GatherTime + FPlatformTime::Seconds() - StartTime) * 1000.0f; // Convert to milliseconds
+        UpdateProcessingMetrics(ProcessingTime);
+        OnBatchProcessed.Broadcast(Slice.LODLevel, AppliedCount);
+    }
 }
 
-void UAIBatchProcessor::ProcessStandardBatch()
+float UAIBatchProcessor::GetUpdateRate(EAILODLevel LODLevel) const
 {
-    ProcessBatch(EAILODLevel::Standard);
+    switch (LODLevel) {
+    case EAILODLevel::Inactive:
+        return BatchSettings.InactiveBatchUpdateRate;
+    case EAILODLevel::Minimal:
+        return BatchSettings.MinimalBatchUpdateRate;
+    case EAILODLevel::Standard:
+        return BatchSettings.StandardBatchUpdateRate;
+    case EAILODLevel::High:
+        return BatchSettings.HighBatchUpdateRate;
+    case EAILODLevel::Maximum:
+    default:
+        return BatchSettings.MaximumBatchUpdateRate;
+    }
 }
 
-void UAIBatchProcessor::ProcessHighBatch()
+float UAIBatchProcessor::GetFrameBudgetMs(EAILODLevel LODLevel) const
 {
-    ProcessBatch(EAILODLevel::High);
+    switch (LODLevel) {
+    case EAILODLevel::Minimal:
+        return BatchSettings.MinimalFrameBudgetMs;
+    case EAILODLevel::Standard:
+        return BatchSettings.StandardFrameBudgetMs;
+    case EAILODLevel::High:
+        return BatchSettings.HighFrameBudgetMs;
+    case EAILODLevel::Maximum:
+        return BatchSettings.MaximumFrameBudgetMs;
+    default:
+        return 0.0f;
+    }
 }
 
-void UAIBatchProcessor::ProcessMaximumBatch()
+void UAIBatchProcessor::ComputeGuardUpdate(const FPortalAIBatchSnapshot& Snapshot, FPortalAIBatchResult& OutResult)
 {
-    // Process all Maximum LOD AI every frame
-    const double StartTime = FPlatformTime::Seconds();
-
-    for (TObjectPtr<AACFAIController> AIController : CurrentBatches.MaximumBatch) {
-        if (AIController && IsValid(AIController)) {
-            if (APortalDefenseAIController* PortalAI = Cast<APortalDefenseAIController>(AIController)) {
-                PortalAI->UpdatePatrolLogic();
-                PortalAI->UpdateCombatBehavior();
-                PortalAI->UpdateTargeting();
-                PortalAI->Tick(LastFrameTime / 1000.0f);
-            }
+    static constexpr float PatrolWaypointStep = UE_PI / 4.0f;
+    static constexpr float PatrolAcceptanceRadius = 100.0f;
+
+    OutResult.NewPatrolAngle = Snapshot.PatrolAngle;
+    OutResult.NewPatrolTarget = Snapshot.CurrentPatrolTarget;
+    OutResult.bIssuePatrolMove = false;
+
+    // Advance to the next waypoint on the patrol circle once the current one is reached
+    if (Snapshot.bIsPatrolling && !Snapshot.bHasCombatTarget) {
+        const bool bNoTarget = Snapshot.CurrentPatrolTarget.IsZero();
+        const bool bReachedTarget = FVector::DistSquared2D(Snapshot.PawnLocation, Snapshot.CurrentPatrolTarget) <= FMath::Square(PatrolAcceptanceRadius);
+
+        if (bNoTarget || bReachedTarget) {
+            const float Step = Snapshot.bClockwisePatrol ? PatrolWaypointStep : -PatrolWaypointStep;
+            OutResult.NewPatrolAngle = FMath::UnwindRadians(Snapshot.PatrolAngle + Step);
+            OutResult.NewPatrolTarget = Snapshot.PatrolCenter
+                + FVector(FMath::Cos(OutResult.NewPatrolAngle), FMath::Sin(OutResult.NewPatrolAngle), 0.0f) * Snapshot.PatrolRadius;
+            OutResult.bIssuePatrolMove = true;
         }
     }
 
-    const double EndTime = FPlatformTime::Seconds();
-    const float ProcessingTime = (EndTime - StartTime) * 1000.0f;
-
-    UpdateProcessingMetrics(ProcessingTime);
-    OnBatchProcessed.Broadcast(EAILODLevel::Maximum, CurrentBatches.MaximumBatch.Num());
+    if (Snapshot.bHasCombatTarget) {
+        OutResult.DistanceToCombatTarget = FVector::Dist(Snapshot.PawnLocation, Snapshot.CombatTargetLocation);
+        OutResult.bCombatTargetInRange = OutResult.DistanceToCombatTarget <= Snapshot.AttackRange;
+    } else {
+        OutResult.DistanceToCombatTarget = 0.0f;
+        OutResult.bCombatTargetInRange = false;
+    }
 }
 
 void UAIBatchProcessor::UpdateProcessingMetrics(float ProcessingTime)
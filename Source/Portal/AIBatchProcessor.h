@@ -11,6 +11,7 @@
 #include "EngineUtils.h"
 #include "GameFramework/GameModeBase.h"
 #include "HAL/PlatformFilemanager.h"
+#include "PortalAIBatchTypes.h"
 #include "PortalDefenseAIController.h"
 #include "AIBatchProcessor.generated.h"
 
@@ -65,6 +66,20 @@ struct FAIBatchSettings {
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Settings")
     float MaximumBatchUpdateRate = 0.0f; // Every tick
 
+    // Game-thread time (gather + apply) each LOD level may spend per frame, in milliseconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Settings")
+    float MinimalFrameBudgetMs = 0.25f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Settings")
+    float StandardFrameBudgetMs = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Settings")
+    float HighFrameBudgetMs = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Settings")
+    float MaximumFrameBudgetMs = 2.0f;
+
+    // Run the compute phase across worker threads
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Settings")
     bool bUseAsyncProcessing = true;
 
@@ -95,6 +110,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Batch Processing")
     void UpdateBatches();
 
+    // Gathers, computes and applies one budgeted slice of the given LOD batch
     UFUNCTION(BlueprintCallable, Category = "AI Batch Processing")
     void ProcessBatch(EAILODLevel LODLevel);
 
@@ -104,6 +120,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Batch Processing")
     void RemoveAIFromBatch(AACFAIController* AIController, EAILODLevel LODLevel);
 
+    UFUNCTION(BlueprintCallable, Category = "AI Batch Processing")
+    void RemoveAIFromAllBatches(AACFAIController* AIController);
+
+    // Same as ProcessBatch; the compute phase runs on worker threads when bUseAsyncProcessing is set
     UFUNCTION(BlueprintCallable, Category = "AI Batch Processing")
     void ProcessBatchAsync(EAILODLevel LODLevel);
 
@@ -154,26 +174,39 @@ protected:
 private:
     static TObjectPtr<UAIBatchProcessor> InstancePtr;
 
-    FTimerHandle InactiveBatchTimer;
-    FTimerHandle MinimalBatchTimer;
-    FTimerHandle StandardBatchTimer;
-    FTimerHandle HighBatchTimer;
-
-    int32 CurrentInactiveBatchIndex = 0;
-    int32 CurrentMinimalBatchIndex = 0;
-    int32 CurrentStandardBatchIndex = 0;
-    int32 CurrentHighBatchIndex = 0;
+    // Contiguous range of the frame buffers gathered from one LOD batch
+    struct FBatchSlice {
+        EAILODLevel LODLevel = EAILODLevel::Standard;
+        int32 Start = 0;
+        int32 Num = 0;
+        // Batch entries visited by the gather, invalid ones included
+        int32 BatchNum = 0;
+        double GatherTime = 0.0;
+    };
+
+    // Frame buffers: filled on the game thread, computed in parallel, applied on the game thread
+    TArray<FPortalAIBatchSnapshot> Snapshots;
+    TArray<FPortalAIBatchResult> Results;
+    TArray<TWeakObjectPtr<APortalDefenseAIController>> SnapshotControllers;
+    // Offset of each snapshot from the cursor of its batch
+    TArray<int32> SnapshotBatchOffsets;
+    TArray<FBatchSlice> Slices;
+
+    // Round-robin position and time since last slice, per EAILODLevel
+    int32 BatchCursors[5] = { 0, 0, 0, 0, 0 };
+    float BatchAccumulators[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
 
     TArray<float> ProcessingTimes;
     float LastFrameTime = 16.67f;
-
-    void InitializeBatchTimers();
-    void ClearBatchTimers();
-    void ProcessInactiveBatch();
-    void ProcessMinimalBatch();
-    void ProcessStandardBatch();
-    void ProcessHighBatch();
-    void ProcessMaximumBatch();
+    float BatchUpdateTimer = 0.0f;
+
+    void ResetFrameBuffers();
+    void GatherBatch(EAILODLevel LODLevel);
+    void ComputeBatches();
+    void ApplyBatches();
+    float GetUpdateRate(EAILODLevel LODLevel) const;
+    float GetFrameBudgetMs(EAILODLevel LODLevel) const;
+    static void ComputeGuardUpdate(const FPortalAIBatchSnapshot& Snapshot, FPortalAIBatchResult& OutResult);
     void UpdateProcessingMetrics(float ProcessingTime);
     void CleanupInvalidAI();
     TArray<TObjectPtr<AACFAIController>>& GetBatchByLOD(EAILODLevel LODLevel);
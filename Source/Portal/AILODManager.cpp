@@ -4,6 +4,7 @@
 #include "Algo/Sort.h"
 #include "Animation/AnimInstance.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
+#include "Components/ACFDamageHandlerComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
@@ -30,10 +31,11 @@ UAILODManager::UAILODManager()
     LODSettings.LODUpdateFrequency = 0.5f;
     LODSettings.bUsePlayerPredictiveLOD = true;
     LODSettings.PredictionRadius = 1500.0f;
+    LODSettings.OffScreenDistanceScale = 1.5f;
+    LODSettings.OnScreenHalfAngle = 60.0f;
+    LODSettings.RecentDamageWindow = 5.0f;
 
     AverageFrameTime = 16.67f;
-    PredictedPlayerPosition = FVector::ZeroVector;
-    LastPlayerPosition = FVector::ZeroVector;
 }
 
 void UAILODManager::BeginPlay()
@@ -42,7 +44,7 @@ void UAILODManager::BeginPlay()
 
     InstancePtr = this;
 
-    UpdatePlayerReference();
+    UpdateViewers();
     StartLODUpdateTimer();
 
     // Start performance monitoring
@@ -56,6 +58,10 @@ void UAILODManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     StopLODUpdateTimer();
 
+    for (FAILODData& Data : RegisteredAI) {
+        UnbindDamageEvents(Data);
+    }
+
     if (GetWorld()) {
         GetWorld()->GetTimerManager().ClearTimer(PerformanceMonitorTimer);
     }
@@ -98,10 +104,8 @@ void UAILODManager::RegisterAI(AACFAIController* AIController)
     }
 
     // Check if already registered
-    for (const FAILODData& Data : RegisteredAI) {
-        if (Data.AIController == AIController) {
-            return; // Already registered
-        }
+    if (RegisteredAIIndices.Contains(AIController)) {
+        return;
     }
 
     // Create new LOD data entry
@@ -113,8 +117,10 @@ void UAILODManager::RegisterAI(AACFAIController* AIController)
     NewData.bInCombat = false;
     NewData.bIsEngagingPlayer = false;
     NewData.LastLODUpdateTime = GetWorld()->GetTimeSeconds();
+    BindDamageEvents(NewData);
 
-    RegisteredAI.Add(NewData);
+    RegisteredAIIndices.Add(AIController, RegisteredAI.Add(NewData));
+    LODCounts[static_cast<int32>(EAILODLevel::Standard)]++;
 
     UE_LOG(LogTemp, Log, TEXT("AI LOD Manager: Registered AI %s (Total: %d)"),
         *AIController->GetName(), RegisteredAI.Num());
@@ -126,9 +132,16 @@ void UAILODManager::UnregisterAI(AACFAIController* AIController)
         return;
     }
 
-    RegisteredAI.RemoveAll([AIController](const FAILODData& Data) {
-        return Data.AIController == AIController;
-    });
+    int32 Index = INDEX_NONE;
+    if (RegisteredAIIndices.RemoveAndCopyValue(AIController, Index)) {
+        UnbindDamageEvents(RegisteredAI[Index]);
+        LODCounts[static_cast<int32>(RegisteredAI[Index].CurrentLODLevel)]--;
+
+        RegisteredAI.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        if (RegisteredAI.IsValidIndex(Index)) {
+            RegisteredAIIndices.Add(RegisteredAI[Index].AIController, Index);
+        }
+    }
 
     // Remove from forced LOD timers
     ForcedLODTimers.Remove(AIController);
@@ -145,75 +158,83 @@ void UAILODManager::UpdateAILOD()
 
     const float CurrentTime = GetWorld()->GetTimeSeconds();
 
-    // Update player position prediction
-    PredictPlayerPosition();
+    // Refresh every connected viewer and its predicted position
+    UpdateViewers();
 
-    // Track LOD level counts
-    TMap<EAILODLevel, int32> LODCounts;
-    LODCounts.Add(EAILODLevel::Inactive, 0);
-    LODCounts.Add(EAILODLevel::Minimal, 0);
-    LODCounts.Add(EAILODLevel::Standard, 0);
-    LODCounts.Add(EAILODLevel::High, 0);
-    LODCounts.Add(EAILODLevel::Maximum, 0);
+    RankedCandidates.Reset();
 
-    // Update all AI LOD data
-    for (FAILODData& Data : RegisteredAI) {
+    int32 MaximumBudget = LODSettings.MaxMaximumLODAI;
+    int32 HighBudget = LODSettings.MaxHighLODAI;
+
+    // Distance-based levels for everyone; AI that want a capped level are deferred to the ranking below
+    for (int32 Index = 0; Index < RegisteredAI.Num(); ++Index) {
+        FAILODData& Data = RegisteredAI[Index];
         if (!Data.AIController || !IsValid(Data.AIController)) {
             continue;
         }
 
-        UpdateAILODData(Data);
+        UpdateAILODData(Data, CurrentTime);
 
-        // Calculate new LOD level
-        EAILODLevel NewLODLevel = CalculateAILODLevel(Data);
-
-        // Apply constraints for high-performance LOD levels
-        if (NewLODLevel == EAILODLevel::Maximum && LODCounts[EAILODLevel::Maximum] >= LODSettings.MaxMaximumLODAI) {
-            NewLODLevel = EAILODLevel::High;
+        // Forced levels are kept as is and consume the budgets first
+        const float* ForcedTimer = ForcedLODTimers.Find(Data.AIController);
+        if (ForcedTimer && *ForcedTimer > 0.0f) {
+            if (Data.CurrentLODLevel == EAILODLevel::Maximum) {
+                MaximumBudget--;
+            } else if (Data.CurrentLODLevel == EAILODLevel::High) {
+                HighBudget--;
+            }
+            continue;
         }
 
-        if (NewLODLevel == EAILODLevel::High && LODCounts[EAILODLevel::High] >= LODSettings.MaxHighLODAI) {
-            NewLODLevel = EAILODLevel::Standard;
+        const EAILODLevel DesiredLODLevel = CalculateAILODLevel(Data);
+        if (DesiredLODLevel >= EAILODLevel::High) {
+            RankedCandidates.Add(Index);
+        } else {
+            ApplyLODLevel(Data, DesiredLODLevel, CurrentTime);
         }
+    }
 
-        // Check for forced LOD override
-        if (ForcedLODTimers.Contains(Data.AIController)) {
-            float* Timer = ForcedLODTimers.Find(Data.AIController);
-            if (Timer && *Timer > 0.0f) {
-                // Keep current forced LOD level
-                NewLODLevel = Data.CurrentLODLevel;
-            }
-        }
+    // Hand the capped budgets out by priority. Only the top of the heap is ever popped in order,
+    // so ranking costs O(n + k log n) for k budget slots instead of a full sort.
+    const auto ByPriority = [this](int32 A, int32 B) {
+        return RegisteredAI[A].LODPriority > RegisteredAI[B].LODPriority;
+    };
+    RankedCandidates.Heapify(ByPriority);
 
-        // Update LOD level if changed
-        if (Data.CurrentLODLevel != NewLODLevel) {
-            EAILODLevel PreviousLOD = Data.CurrentLODLevel;
-            Data.CurrentLODLevel = NewLODLevel;
-            Data.LastLODUpdateTime = CurrentTime;
+    while (RankedCandidates.Num() > 0 && (MaximumBudget > 0 || HighBudget > 0)) {
+        int32 Index = INDEX_NONE;
+        RankedCandidates.HeapPop(Index, ByPriority, EAllowShrinking::No);
 
-            // Broadcast LOD change event
-            OnAILODChanged.Broadcast(Data.AIController, NewLODLevel);
+        FAILODData& Data = RegisteredAI[Index];
+        EAILODLevel NewLODLevel = EAILODLevel::Standard;
 
-            UE_LOG(LogTemp, VeryVerbose, TEXT("AI LOD Manager: %s LOD changed from %d to %d"),
-                *Data.AIController->GetName(),
-                static_cast<int32>(PreviousLOD),
-                static_cast<int32>(NewLODLevel));
+        if (CalculateAILODLevel(Data) == EAILODLevel::Maximum && MaximumBudget > 0) {
+            NewLODLevel = EAILODLevel::Maximum;
+            MaximumBudget--;
+        } else if (HighBudget > 0) {
+            NewLODLevel = EAILODLevel::High;
+            HighBudget--;
         }
 
-        // Update count
-        LODCounts[Data.CurrentLODLevel]++;
+        ApplyLODLevel(Data, NewLODLevel, CurrentTime);
+    }
+
+    // Budgets exhausted, whatever is left runs at Standard
+    for (int32 Index : RankedCandidates) {
+        ApplyLODLevel(RegisteredAI[Index], EAILODLevel::Standard, CurrentTime);
     }
 
     // Process forced LOD timers
     ProcessForcedLODTimers();
 
     // Log performance metrics
-    UE_LOG(LogTemp, VeryVerbose, TEXT("AI LOD Distribution - Inactive: %d, Minimal: %d, Standard: %d, High: %d, Maximum: %d"),
-        LODCounts[EAILODLevel::Inactive],
-        LODCounts[EAILODLevel::Minimal],
-        LODCounts[EAILODLevel::Standard],
-        LODCounts[EAILODLevel::High],
-        LODCounts[EAILODLevel::Maximum]);
+    UE_LOG(LogTemp, VeryVerbose, TEXT("AI LOD Distribution - Inactive: %d, Minimal: %d, Standard: %d, High: %d, Maximum: %d (Viewers: %d)"),
+        GetAICountByLOD(EAILODLevel::Inactive),
+        GetAICountByLOD(EAILODLevel::Minimal),
+        GetAICountByLOD(EAILODLevel::Standard),
+        GetAICountByLOD(EAILODLevel::High),
+        GetAICountByLOD(EAILODLevel::Maximum),
+        Viewers.Num());
 }
 
 void UAILODManager::SetAILODLevel(AACFAIController* AIController, EAILODLevel NewLODLevel)
@@ -222,21 +243,16 @@ void UAILODManager::SetAILODLevel(AACFAIController* AIController, EAILODLevel Ne
         return;
     }
 
-    for (FAILODData& Data : RegisteredAI) {
-        if (Data.AIController == AIController) {
-            if (Data.CurrentLODLevel != NewLODLevel) {
-                EAILODLevel PreviousLOD = Data.CurrentLODLevel;
-                Data.CurrentLODLevel = NewLODLevel;
-                Data.LastLODUpdateTime = GetWorld()->GetTimeSeconds();
-
-                OnAILODChanged.Broadcast(AIController, NewLODLevel);
-
-                UE_LOG(LogTemp, Log, TEXT("AI LOD Manager: Manually set %s LOD from %d to %d"),
-                    *AIController->GetName(),
-                    static_cast<int32>(PreviousLOD),
-                    static_cast<int32>(NewLODLevel));
-            }
-            break;
+    if (const int32* Index = RegisteredAIIndices.Find(AIController)) {
+        FAILODData& Data = RegisteredAI[*Index];
+        if (Data.CurrentLODLevel != NewLODLevel) {
+            const EAILODLevel PreviousLOD = Data.CurrentLODLevel;
+            ApplyLODLevel(Data, NewLODLevel, GetWorld()->GetTimeSeconds());
+
+            UE_LOG(LogTemp, Log, TEXT("AI LOD Manager: Manually set %s LOD from %d to %d"),
+                *AIController->GetName(),
+                static_cast<int32>(PreviousLOD),
+                static_cast<int32>(NewLODLevel));
         }
     }
 }
@@ -267,15 +283,11 @@ void UAILODManager::ForceMaximumLOD(AACFAIController* AIController, float Durati
         *AIController->GetName(), Duration);
 }
 
-int32 UAILODManager::GetAICountByLOD(EAILODLevel LODLevel) const
+void UAILODManager::NotifyAIDamaged(AACFAIController* AIController)
 {
-    int32 Count = 0;
-    for (const FAILODData& Data : RegisteredAI) {
-        if (Data.CurrentLODLevel == LODLevel) {
-            Count++;
-        }
+    if (const int32* Index = RegisteredAIIndices.Find(AIController)) {
+        RegisteredAI[*Index].LastDamageTime = GetWorld()->GetTimeSeconds();
     }
-    return Count;
 }
 
 void UAILODManager::StartLODUpdateTimer()
@@ -325,36 +337,29 @@ void UAILODManager::MonitorPerformance()
     }
 }
 
-void UAILODManager::UpdatePlayerReference()
+void UAILODManager::UpdateViewers()
 {
-    if (GetWorld()) {
-        if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController()) {
-            if (APawn* PlayerPawn = PlayerController->GetPawn()) {
-                LastPlayerPosition = PlayerPawn->GetActorLocation();
-            }
-        }
-    }
-}
+    Viewers.Reset();
 
-void UAILODManager::PredictPlayerPosition()
-{
-    if (!GetWorld()) {
+    UWorld* World = GetWorld();
+    if (!World) {
         return;
     }
 
-    if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController()) {
-        if (APawn* PlayerPawn = PlayerController->GetPawn()) {
-            FVector CurrentPlayerPosition = PlayerPawn->GetActorLocation();
-
-            if (LODSettings.bUsePlayerPredictiveLOD) {
-                FVector PlayerVelocity = (CurrentPlayerPosition - LastPlayerPosition) / LODSettings.LODUpdateFrequency;
-                PredictedPlayerPosition = CurrentPlayerPosition + (PlayerVelocity * LODSettings.LODUpdateFrequency * 2.0f);
-            } else {
-                PredictedPlayerPosition = CurrentPlayerPosition;
-            }
-
-            LastPlayerPosition = CurrentPlayerPosition;
+    // Every player controller on the server, not just the first local one
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+        APlayerController* PlayerController = It->Get();
+        APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+        if (!PlayerPawn) {
+            continue;
         }
+
+        FAILODViewer& Viewer = Viewers.AddDefaulted_GetRef();
+        Viewer.Location = PlayerPawn->GetActorLocation();
+        Viewer.ViewDirection = PlayerController->GetControlRotation().Vector();
+        Viewer.PredictedLocation = LODSettings.bUsePlayerPredictiveLOD
+            ? Viewer.Location + (PlayerPawn->GetVelocity() * LODSettings.LODUpdateFrequency * 2.0f)
+            : Viewer.Location;
     }
 }
 
@@ -365,36 +370,49 @@ EAILODLevel UAILODManager::CalculateAILODLevel(const FAILODData& AIData) const
         return AIData.DistanceToPlayer <= LODSettings.MaximumDistance ? EAILODLevel::Maximum : EAILODLevel::High;
     }
 
-    // Distance-based LOD calculation using predicted player position
-    FVector ComparisonPosition = LODSettings.bUsePlayerPredictiveLOD ? PredictedPlayerPosition : LastPlayerPosition;
-
-    if (AIData.AIController && AIData.AIController->GetPawn()) {
-        float DistanceToPosition = FVector::Dist(AIData.AIController->GetPawn()->GetActorLocation(), ComparisonPosition);
-
-        if (DistanceToPosition <= LODSettings.MaximumDistance) {
-            return EAILODLevel::Maximum;
-        } else if (DistanceToPosition <= LODSettings.HighDistance) {
-            return EAILODLevel::High;
-        } else if (DistanceToPosition <= LODSettings.StandardDistance) {
-            return EAILODLevel::Standard;
-        } else if (DistanceToPosition <= LODSettings.MinimalDistance) {
-            return EAILODLevel::Minimal;
-        }
+    // Distance-based LOD calculation using the weighted distance to the nearest viewer
+    if (AIData.DistanceToPlayer <= LODSettings.MaximumDistance) {
+        return EAILODLevel::Maximum;
+    } else if (AIData.DistanceToPlayer <= LODSettings.HighDistance) {
+        return EAILODLevel::High;
+    } else if (AIData.DistanceToPlayer <= LODSettings.StandardDistance) {
+        return EAILODLevel::Standard;
+    } else if (AIData.DistanceToPlayer <= LODSettings.MinimalDistance) {
+        return EAILODLevel::Minimal;
     }
 
     return EAILODLevel::Inactive;
 }
 
-void UAILODManager::UpdateAILODData(FAILODData& AIData)
+void UAILODManager::UpdateAILODData(FAILODData& AIData, float CurrentTime)
 {
     if (!AIData.AIController || !IsValid(AIData.AIController)) {
         return;
     }
 
-    // Update distance to player
-    if (AIData.AIController->GetPawn()) {
-        FVector ComparisonPosition = LODSettings.bUsePlayerPredictiveLOD ? PredictedPlayerPosition : LastPlayerPosition;
-        AIData.DistanceToPlayer = FVector::Dist(AIData.AIController->GetPawn()->GetActorLocation(), ComparisonPosition);
+    if (AIData.AIController->GetPawn() != AIData.DamageEventsPawn.Get()) {
+        BindDamageEvents(AIData);
+    }
+
+    // Minimum weighted distance to any viewer; AI outside a viewer's view cone count as further away
+    if (const APawn* AIPawn = AIData.AIController->GetPawn()) {
+        const FVector AILocation = AIPawn->GetActorLocation();
+        const float OnScreenCos = FMath::Cos(FMath::DegreesToRadians(LODSettings.OnScreenHalfAngle));
+
+        float WeightedDistance = 9999.0f;
+        bool bOnScreen = false;
+
+        for (const FAILODViewer& Viewer : Viewers) {
+            const FVector ComparisonPosition = LODSettings.bUsePlayerPredictiveLOD ? Viewer.PredictedLocation : Viewer.Location;
+            const float Distance = FVector::Dist(AILocation, ComparisonPosition);
+            const bool bInViewCone = FVector::DotProduct(Viewer.ViewDirection, (AILocation - Viewer.Location).GetSafeNormal()) >= OnScreenCos;
+
+            bOnScreen |= bInViewCone;
+            WeightedDistance = FMath::Min(WeightedDistance, bInViewCone ? Distance : Distance * LODSettings.OffScreenDistanceScale);
+        }
+
+        AIData.DistanceToPlayer = WeightedDistance;
+        AIData.bLikelyOnScreen = bOnScreen;
     }
 
     // Update combat status for Portal Defense AI Controllers
@@ -412,12 +430,76 @@ void UAILODManager::UpdateAILODData(FAILODData& AIData)
     if (AIData.bIsEngagingPlayer)
         Priority += 3.0f;
 
+    // Visible AI matter more than the ones behind every player
+    if (AIData.bLikelyOnScreen)
+        Priority += 1.5f;
+
+    // Recently damaged AI fade back to normal priority over the damage window
+    if (AIData.LastDamageTime >= 0.0f && LODSettings.RecentDamageWindow > 0.0f) {
+        Priority += 2.0f * FMath::Max(0.0f, 1.0f - (CurrentTime - AIData.LastDamageTime) / LODSettings.RecentDamageWindow);
+    }
+
     // Distance-based priority
     Priority += FMath::Max(0.0f, (LODSettings.StandardDistance - AIData.DistanceToPlayer) / LODSettings.StandardDistance);
 
     AIData.LODPriority = Priority;
 }
 
+void UAILODManager::ApplyLODLevel(FAILODData& AIData, EAILODLevel NewLODLevel, float CurrentTime)
+{
+    if (AIData.CurrentLODLevel == NewLODLevel) {
+        return;
+    }
+
+    const EAILODLevel PreviousLOD = AIData.CurrentLODLevel;
+    LODCounts[static_cast<int32>(PreviousLOD)]--;
+    LODCounts[static_cast<int32>(NewLODLevel)]++;
+
+    AIData.CurrentLODLevel = NewLODLevel;
+    AIData.LastLODUpdateTime = CurrentTime;
+
+    // Broadcast LOD change event
+    OnAILODChanged.Broadcast(AIData.AIController, NewLODLevel);
+
+    UE_LOG(LogTemp, VeryVerbose, TEXT("AI LOD Manager: %s LOD changed from %d to %d"),
+        *AIData.AIController->GetName(),
+        static_cast<int32>(PreviousLOD),
+        static_cast<int32>(NewLODLevel));
+}
+
+void UAILODManager::BindDamageEvents(FAILODData& AIData)
+{
+    // Pooled pawns are possessed again, the previous pawn must stop reporting to this entry
+    UnbindDamageEvents(AIData);
+
+    APawn* AIPawn = AIData.AIController ? AIData.AIController->GetPawn() : nullptr;
+    AIData.DamageEventsPawn = AIPawn;
+    if (!AIPawn) {
+        return;
+    }
+
+    if (UACFDamageHandlerComponent* DamageHandler = AIPawn->FindComponentByClass<UACFDamageHandlerComponent>()) {
+        DamageHandler->OnDamageReceived.AddUniqueDynamic(this, &UAILODManager::OnAIDamageReceived);
+        AIData.BoundDamageHandler = DamageHandler;
+    }
+}
+
+void UAILODManager::UnbindDamageEvents(FAILODData& AIData)
+{
+    if (UACFDamageHandlerComponent* DamageHandler = AIData.BoundDamageHandler.Get()) {
+        DamageHandler->OnDamageReceived.RemoveDynamic(this, &UAILODManager::OnAIDamageReceived);
+    }
+    AIData.BoundDamageHandler.Reset();
+    AIData.DamageEventsPawn.Reset();
+}
+
+void UAILODManager::OnAIDamageReceived(const FACFDamageEvent& DamageEvent)
+{
+    if (const APawn* DamagedPawn = Cast<APawn>(DamageEvent.DamageReceiver)) {
+        NotifyAIDamaged(Cast<AACFAIController>(DamagedPawn->GetController()));
+    }
+}
+
 void UAILODManager::ProcessForcedLODTimers()
 {
     const float DeltaTime = LODSettings.LODUpdateFrequency;
@@ -7,10 +7,13 @@
 #include "CoreMinimal.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
+#include "Game/ACFDamageType.h"
 #include "GameFramework/GameModeBase.h"
 #include "PortalDefenseAIController.h"
 #include "AILODManager.generated.h"
 
+class UACFDamageHandlerComponent;
+
 UENUM(BlueprintType)
 enum class EAILODLevel : uint8 {
     Inactive UMETA(DisplayName = "Inactive"),
@@ -53,6 +56,31 @@ struct FAILODSettings {
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD Settings")
     float PredictionRadius = 1500.0f;
+
+    // Distance multiplier for AI outside a viewer's view cone
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD Settings")
+    float OffScreenDistanceScale = 1.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD Settings")
+    float OnScreenHalfAngle = 60.0f;
+
+    // Seconds after taking damage during which an AI keeps a priority boost
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD Settings")
+    float RecentDamageWindow = 5.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FAILODViewer {
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "LOD Viewer")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "LOD Viewer")
+    FVector PredictedLocation = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "LOD Viewer")
+    FVector ViewDirection = FVector::ForwardVector;
 };
 
 USTRUCT(BlueprintType)
@@ -77,9 +105,21 @@ struct FAILODData {
     UPROPERTY(BlueprintReadOnly, Category = "LOD Data")
     bool bIsEngagingPlayer = false;
 
+    UPROPERTY(BlueprintReadOnly, Category = "LOD Data")
+    bool bLikelyOnScreen = false;
+
     UPROPERTY(BlueprintReadOnly, Category = "LOD Data")
     float LastLODUpdateTime = 0.0f;
 
+    UPROPERTY(BlueprintReadOnly, Category = "LOD Data")
+    float LastDamageTime = -1.0f;
+
+    // Pawn checked for a damage handler, checked again once the controller possesses another one
+    TWeakObjectPtr<APawn> DamageEventsPawn;
+
+    // Damage handler of DamageEventsPawn reporting hits to the manager, null if it has none
+    TWeakObjectPtr<UACFDamageHandlerComponent> BoundDamageHandler;
+
     FAILODData()
     {
         AIController = nullptr;
@@ -88,7 +128,9 @@ struct FAILODData {
         LODPriority = 1.0f;
         bInCombat = false;
         bIsEngagingPlayer = false;
+        bLikelyOnScreen = false;
         LastLODUpdateTime = 0.0f;
+        LastDamageTime = -1.0f;
     }
 };
 
@@ -130,12 +172,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI LOD")
     void ForceMaximumLOD(AACFAIController* AIController, float Duration = 5.0f);
 
+    UFUNCTION(BlueprintCallable, Category = "AI LOD")
+    void NotifyAIDamaged(AACFAIController* AIController);
+
     // Analytics
     UFUNCTION(BlueprintPure, Category = "AI LOD")
     int32 GetRegisteredAICount() const { return RegisteredAI.Num(); }
 
     UFUNCTION(BlueprintPure, Category = "AI LOD")
-    int32 GetAICountByLOD(EAILODLevel LODLevel) const;
+    int32 GetAICountByLOD(EAILODLevel LODLevel) const { return LODCounts[static_cast<int32>(LODLevel)]; }
 
     UFUNCTION(BlueprintPure, Category = "AI LOD")
     TArray<FAILODData> GetCurrentLODData() const { return RegisteredAI; }
@@ -164,11 +209,9 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "AI LOD")
     float AverageFrameTime = 16.67f;
 
+    // Every connected player's view, refreshed each LOD update
     UPROPERTY(BlueprintReadOnly, Category = "AI LOD")
-    FVector PredictedPlayerPosition = FVector::ZeroVector;
-
-    UPROPERTY(BlueprintReadOnly, Category = "AI LOD")
-    FVector LastPlayerPosition = FVector::ZeroVector;
+    TArray<FAILODViewer> Viewers;
 
 private:
     static TObjectPtr<UAILODManager> InstancePtr;
@@ -179,13 +222,27 @@ private:
     TArray<float> FrameTimes;
     TMap<TObjectPtr<AACFAIController>, float> ForcedLODTimers;
 
+    // Controller -> slot in RegisteredAI
+    TMap<TObjectPtr<AACFAIController>, int32> RegisteredAIIndices;
+
+    // Number of registered AI per EAILODLevel, kept in sync on every level change
+    int32 LODCounts[5] = { 0, 0, 0, 0, 0 };
+
+    // Scratch buffer for the budget ranking, reused across updates
+    TArray<int32> RankedCandidates;
+
     void StartLODUpdateTimer();
     void StopLODUpdateTimer();
     void OnLODUpdateTimer();
     void MonitorPerformance();
-    void UpdatePlayerReference();
-    void PredictPlayerPosition();
+    void UpdateViewers();
     EAILODLevel CalculateAILODLevel(const FAILODData& AIData) const;
-    void UpdateAILODData(FAILODData& AIData);
+    void UpdateAILODData(FAILODData& AIData, float CurrentTime);
+    void ApplyLODLevel(FAILODData& AIData, EAILODLevel NewLODLevel, float CurrentTime);
+    void BindDamageEvents(FAILODData& AIData);
+    void UnbindDamageEvents(FAILODData& AIData);
     void ProcessForcedLODTimers();
+
+    UFUNCTION()
+    void OnAIDamageReceived(const FACFDamageEvent& DamageEvent);
 };
\ No newline at end of file
@@ -26,6 +26,14 @@ UAIOverlordManager::UAIOverlordManager()
     CoordinateCommandTag = FGameplayTag::RequestGameplayTag(FName("AI.Commands.Coordinate"));
     DefaultAIState = FGameplayTag::RequestGameplayTag(FName("AI.State.Default"));
     PatrolAIState = FGameplayTag::RequestGameplayTag(FName("AI.State.Patrol"));
+
+    // Setup command bus subscriptions
+    const FPortalAICommandTags& CommandTags = FPortalAICommandTags::Get();
+    DefaultGuardCommands.AddTag(CommandTags.Investigate);
+    DefaultGuardCommands.AddTag(CommandTags.IncreaseAggression);
+    DefaultGuardCommands.AddTag(CommandTags.IncreaseDetectionRange);
+    DefaultGuardCommands.AddTag(CommandTags.AdaptToPlayerRoutes);
+    DefaultGuardCommands.AddTag(CommandTags.ReinforceArea);
 }
 
 void UAIOverlordManager::Initialize(FSubsystemCollectionBase& Collection)
@@ -45,8 +53,11 @@ void UAIOverlordManager::Deinitialize()
     if (UWorld* World = GetWorld()) {
         World->GetTimerManager().ClearTimer(AnalysisTimer);
         World->GetTimerManager().ClearTimer(PlayerTrackingTimer);
+        World->GetTimerManager().ClearTimer(CommandDispatchTimer);
     }
 
+    PendingCommands.Empty();
+    CommandBuckets.Empty();
     RegisteredAI.Empty();
     AnalysisHistory.Empty();
 
@@ -71,6 +82,10 @@ void UAIOverlordManager::RegisterAI(AACFAIController* AIController)
     if (AIController && !RegisteredAI.Contains(AIController)) {
         RegisteredAI.Add(AIController);
 
+        for (const FGameplayTag& CommandTag : DefaultGuardCommands) {
+            SubscribeToCommand(AIController, CommandTag);
+        }
+
         CurrentAnalysisData.ActivePatrolGuards = RegisteredAI.Num();
 
         UE_LOG(LogTemp, Log, TEXT("AI Overlord: Registered patrol guard %s"), *AIController->GetName());
@@ -81,6 +96,7 @@ void UAIOverlordManager::UnregisterAI(AACFAIController* AIController)
 {
     if (AIController) {
         RegisteredAI.Remove(AIController);
+        UnsubscribeFromCommands(AIController);
         CurrentAnalysisData.ActivePatrolGuards = RegisteredAI.Num();
         UE_LOG(LogTemp, Log, TEXT("AI Overlord: Unregistered patrol guard %s"), *AIController->GetName());
     }
@@ -159,7 +175,7 @@ void UAIOverlordManager::UpdateCaptureProgress(float Progress)
 
     // Increase urgency if capture progress is high
     if (Progress > 0.5f) {
-        IssueGlobalCommand("IncreaseAggression", TArray<FVector>());
+        IssueGlobalCommand(FPortalAICommandTags::Get().IncreaseAggression);
     }
 }
 
@@ -283,78 +299,221 @@ void UAIOverlordManager::AdaptToPlayerBehavior()
 
     // Adjust AI behavior based on player patterns
     if (RecentPlayerPositions.Num() > 20) {
-        // Calculate player's preferred approach routes
-        TArray<FVector> ApproachVectors;
+        // Calculate player's preferred approach route
+        FVector ApproachDirection = FVector::ZeroVector;
         for (int32 i = 1; i < RecentPlayerPositions.Num(); i++) {
             FVector Movement = RecentPlayerPositions[i] - RecentPlayerPositions[i - 1];
             if (Movement.Size() > 100.0f) { // Filter out small movements
-                ApproachVectors.Add(Movement.GetSafeNormal());
+                ApproachDirection += Movement.GetSafeNormal();
             }
         }
 
         // Adapt patrol positions to counter player routes
-        IssueGlobalCommand("AdaptToPlayerRoutes", ApproachVectors);
+        if (!ApproachDirection.IsNearlyZero()) {
+            FPortalAICommand Command;
+            Command.CommandTag = FPortalAICommandTags::Get().AdaptToPlayerRoutes;
+            Command.Direction = ApproachDirection.GetSafeNormal();
+            IssueCommand(Command);
+        }
     }
 }
 
-void UAIOverlordManager::IssueGlobalCommand(const FString& Command, const TArray<FVector>& Parameters)
+void UAIOverlordManager::IssueCommand(const FPortalAICommand& Command)
 {
-    CleanupInvalidAI();
+    if (!Command.CommandTag.IsValid()) {
+        return;
+    }
 
-    for (AACFAIController* AI : RegisteredAI) {
-        if (AI && IsValid(AI)) {
-            if (APortalDefenseAIController* PatrolAI = Cast<APortalDefenseAIController>(AI)) {
-                PatrolAI->ReceiveOverlordCommand(Command, Parameters);
-            }
+    // Identical commands issued in the same frame are delivered once
+    const bool bAlreadyQueued = PendingCommands.ContainsByPredicate([&Command](const FPortalAICommand& Pending) {
+        return Pending.CommandTag == Command.CommandTag && Pending.Location.Equals(Command.Location)
+            && Pending.Direction.Equals(Command.Direction) && Pending.Radius == Command.Radius
+            && Pending.Magnitude == Command.Magnitude && Pending.MaxRecipients == Command.MaxRecipients;
+    });
+
+    if (!bAlreadyQueued) {
+        PendingCommands.Add(Command);
+    }
+
+    UWorld* World = GetWorld();
+    if (World && !World->GetTimerManager().TimerExists(CommandDispatchTimer)) {
+        CommandDispatchTimer = World->GetTimerManager().SetTimerForNextTick(this, &UAIOverlordManager::DispatchPendingCommands);
+    }
+}
+
+void UAIOverlordManager::IssueGlobalCommand(FGameplayTag CommandTag)
+{
+    FPortalAICommand Command;
+    Command.CommandTag = CommandTag;
+    IssueCommand(Command);
+}
+
+void UAIOverlordManager::IssueSelectiveCommand(FGameplayTag CommandTag, int32 MaxUnits, FVector Location)
+{
+    if (MaxUnits <= 0) {
+        return;
+    }
+
+    FPortalAICommand Command;
+    Command.CommandTag = CommandTag;
+    Command.Location = Location;
+    Command.MaxRecipients = MaxUnits;
+    IssueCommand(Command);
+}
+
+void UAIOverlordManager::AlertNearbyGuards(FVector AlertLocation, float AlertRadius)
+{
+    FPortalAICommand Command;
+    Command.CommandTag = FPortalAICommandTags::Get().Investigate;
+    Command.Location = AlertLocation;
+    Command.Radius = AlertRadius;
+    IssueCommand(Command);
+}
+
+void UAIOverlordManager::SubscribeToCommand(AACFAIController* AIController, FGameplayTag CommandTag)
+{
+    if (!AIController || !CommandTag.IsValid()) {
+        return;
+    }
+
+    FCommandBucket& Bucket = CommandBuckets.FindOrAdd(CommandTag);
+    if (!Bucket.Subscribers.Contains(AIController)) {
+        Bucket.Subscribers.Add(AIController);
+        Bucket.CellsFrame = MAX_uint64;
+    }
+}
+
+void UAIOverlordManager::UnsubscribeFromCommands(AACFAIController* AIController)
+{
+    for (auto& Pair : CommandBuckets) {
+        if (Pair.Value.Subscribers.RemoveSwap(AIController) > 0) {
+            Pair.Value.CellsFrame = MAX_uint64;
         }
     }
+}
+
+void UAIOverlordManager::FlushCommands()
+{
+    if (UWorld* World = GetWorld()) {
+        World->GetTimerManager().ClearTimer(CommandDispatchTimer);
+    }
 
-    UE_LOG(LogTemp, Log, TEXT("AI Overlord: Issued global command '%s' to %d guards"), *Command, RegisteredAI.Num());
+    DispatchPendingCommands();
 }
 
-void UAIOverlordManager::IssueSelectiveCommand(const FString& Command, int32 MaxUnits, const TArray<FVector>& Parameters)
+void UAIOverlordManager::DispatchPendingCommands()
 {
+    if (PendingCommands.Num() == 0) {
+        return;
+    }
+
+    // Commands issued while dispatching go to the next batch
+    TArray<FPortalAICommand> Batch = MoveTemp(PendingCommands);
+    PendingCommands.Reset();
+
     CleanupInvalidAI();
 
-    int32 UnitsCommandedCount = 0;
-    for (AACFAIController* AI : RegisteredAI) {
-        if (UnitsCommandedCount >= MaxUnits)
-            break;
+    int32 DeliveredCount = 0;
+    for (const FPortalAICommand& Command : Batch) {
+        FCommandBucket* Bucket = CommandBuckets.Find(Command.CommandTag);
+        if (!Bucket) {
+            continue;
+        }
 
-        if (AI && IsValid(AI)) {
-            if (APortalDefenseAIController* PatrolAI = Cast<APortalDefenseAIController>(AI)) {
-                PatrolAI->ReceiveOverlordCommand(Command, Parameters);
-                UnitsCommandedCount++;
-            }
+        GatherCommandRecipients(*Bucket, Command);
+
+        for (AACFAIController* AI : CommandRecipients) {
+            DeliverCommand(AI, Command);
         }
+
+        DeliveredCount += CommandRecipients.Num();
     }
 
-    UE_LOG(LogTemp, Log, TEXT("AI Overlord: Issued selective command '%s' to %d/%d guards"), *Command, UnitsCommandedCount, MaxUnits);
+    UE_LOG(LogTemp, Verbose, TEXT("AI Overlord: Dispatched %d commands to %d recipients"), Batch.Num(), DeliveredCount);
 }
 
-void UAIOverlordManager::AlertNearbyGuards(FVector AlertLocation, float AlertRadius)
+void UAIOverlordManager::GatherCommandRecipients(FCommandBucket& Bucket, const FPortalAICommand& Command)
 {
-    CleanupInvalidAI();
+    CommandRecipients.Reset();
 
-    TArray<FVector> AlertParameters = { AlertLocation };
+    const int32 MaxRecipients = Command.MaxRecipients > 0 ? Command.MaxRecipients : MAX_int32;
 
-    for (AACFAIController* AI : RegisteredAI) {
-        if (AI && IsValid(AI) && AI->GetPawn()) {
-            float Distance = FVector::Dist(AI->GetPawn()->GetActorLocation(), AlertLocation);
+    if (!Command.IsSpatial()) {
+        for (const TWeakObjectPtr<AACFAIController>& Subscriber : Bucket.Subscribers) {
+            if (CommandRecipients.Num() >= MaxRecipients) {
+                break;
+            }
+
+            AACFAIController* AI = Subscriber.Get();
+            if (AI && AI->GetPawn()) {
+                CommandRecipients.Add(AI);
+            }
+        }
+        return;
+    }
+
+    if (Bucket.CellsFrame != GFrameCounter) {
+        RefreshBucketCells(Bucket);
+    }
+
+    // Only the cells overlapping the command radius are visited
+    const FIntPoint MinCell = GetCommandCell(Command.Location - FVector(Command.Radius));
+    const FIntPoint MaxCell = GetCommandCell(Command.Location + FVector(Command.Radius));
+    const float RadiusSquared = FMath::Square(Command.Radius);
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X) {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y) {
+            const TArray<int32>* Cell = Bucket.Cells.Find(FIntPoint(X, Y));
+            if (!Cell) {
+                continue;
+            }
 
-            if (Distance <= AlertRadius) {
-                if (APortalDefenseAIController* PatrolAI = Cast<APortalDefenseAIController>(AI)) {
-                    PatrolAI->ReceiveOverlordCommand("InvestigateAlert", AlertParameters);
+            for (int32 Index : *Cell) {
+                if (CommandRecipients.Num() >= MaxRecipients) {
+                    return;
                 }
 
-                if (AlertCommandTag.IsValid()) {
-                    SendACFCommand(AI, AlertCommandTag);
+                AACFAIController* AI = Bucket.Subscribers[Index].Get();
+                const APawn* AIPawn = AI ? AI->GetPawn() : nullptr;
+                if (AIPawn && FVector::DistSquared(AIPawn->GetActorLocation(), Command.Location) <= RadiusSquared) {
+                    CommandRecipients.Add(AI);
                 }
             }
         }
     }
+}
 
-    UE_LOG(LogTemp, Log, TEXT("AI Overlord: Alerted guards within %.1f units of %s"), AlertRadius, *AlertLocation.ToString());
+void UAIOverlordManager::DeliverCommand(AACFAIController* AIController, const FPortalAICommand& Command)
+{
+    if (APortalDefenseAIController* PatrolAI = Cast<APortalDefenseAIController>(AIController)) {
+        PatrolAI->ReceiveOverlordCommand(Command);
+    }
+
+    // Alerts also drive the ACF command layer
+    if (Command.CommandTag == FPortalAICommandTags::Get().Investigate && AlertCommandTag.IsValid()) {
+        SendACFCommand(AIController, AlertCommandTag);
+    }
+}
+
+void UAIOverlordManager::RefreshBucketCells(FCommandBucket& Bucket)
+{
+    Bucket.Subscribers.RemoveAllSwap([](const TWeakObjectPtr<AACFAIController>& Subscriber) {
+        return !Subscriber.IsValid();
+    });
+
+    Bucket.Cells.Reset();
+    for (int32 Index = 0; Index < Bucket.Subscribers.Num(); ++Index) {
+        if (const APawn* AIPawn = Bucket.Subscribers[Index]->GetPawn()) {
+            Bucket.Cells.FindOrAdd(GetCommandCell(AIPawn->GetActorLocation())).Add(Index);
+        }
+    }
+
+    Bucket.CellsFrame = GFrameCounter;
+}
+
+FIntPoint UAIOverlordManager::GetCommandCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt(Location.X / CommandCellSize), FMath::FloorToInt(Location.Y / CommandCellSize));
 }
 
 void UAIOverlordManager::StartContinuousAnalysis()
@@ -373,7 +532,7 @@ void UAIOverlordManager::PerformRealTimeAnalysis()
         if (Insight.InsightType == "PlayerMovementPattern") {
             AdaptToPlayerBehavior();
         } else if (Insight.InsightType == "WeakPatrolArea") {
-            IssueSelectiveCommand("ReinforceArea", RegisteredAI.Num() / 3, { Insight.TargetLocation });
+            IssueSelectiveCommand(FPortalAICommandTags::Get().ReinforceArea, RegisteredAI.Num() / 3, Insight.TargetLocation);
         }
     }
 }
@@ -451,7 +610,7 @@ void UAIOverlordManager::AnalyzePlayerBehaviorPatterns()
 
         // If player moves fast, increase AI detection range
         if (AverageSpeed > 500.0f) {
-            IssueGlobalCommand("IncreaseDetectionRange", TArray<FVector>());
+            IssueGlobalCommand(FPortalAICommandTags::Get().IncreaseDetectionRange);
         }
     }
 }
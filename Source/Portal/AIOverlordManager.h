@@ -3,6 +3,7 @@
 #include "ACFAIController.h"
 #include "CoreMinimal.h"
 #include "Engine/TimerHandle.h"
+#include "PortalAICommandTypes.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "AIOverlordManager.generated.h"
 
@@ -137,18 +138,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Overlord")
     void AdaptToPlayerBehavior();
 
-    // Commands
+    // Command Bus
+    // Commands are queued and dispatched together once per frame
     UFUNCTION(BlueprintCallable, Category = "AI Overlord")
-    void IssueGlobalCommand(const FString& Command, const TArray<FVector>& Parameters);
+    void IssueCommand(const FPortalAICommand& Command);
 
-    UFUNCTION(BlueprintCallable, Category = "AI Overlord", CallInEditor, DisplayName = "Issue Global Command (Simple)")
-    void IssueGlobalCommandSimple(const FString& Command) { IssueGlobalCommand(Command, TArray<FVector>()); }
+    UFUNCTION(BlueprintCallable, Category = "AI Overlord", CallInEditor)
+    void IssueGlobalCommand(FGameplayTag CommandTag);
+
+    UFUNCTION(BlueprintCallable, Category = "AI Overlord")
+    void IssueSelectiveCommand(FGameplayTag CommandTag, int32 MaxUnits, FVector Location);
 
     UFUNCTION(BlueprintCallable, Category = "AI Overlord")
-    void IssueSelectiveCommand(const FString& Command, int32 MaxUnits, const TArray<FVector>& Parameters);
+    void SubscribeToCommand(AACFAIController* AIController, FGameplayTag CommandTag);
 
-    UFUNCTION(BlueprintCallable, Category = "AI Overlord", CallInEditor, DisplayName = "Issue Selective Command (Simple)")
-    void IssueSelectiveCommandSimple(const FString& Command, int32 MaxUnits) { IssueSelectiveCommand(Command, MaxUnits, TArray<FVector>()); }
+    UFUNCTION(BlueprintCallable, Category = "AI Overlord")
+    void UnsubscribeFromCommands(AACFAIController* AIController);
+
+    // Dispatches the queued commands immediately instead of waiting for the next frame
+    UFUNCTION(BlueprintCallable, Category = "AI Overlord")
+    void FlushCommands();
 
     UFUNCTION(BlueprintCallable, Category = "AI Overlord")
     void AlertNearbyGuards(FVector AlertLocation, float AlertRadius = 1500.0f);
@@ -235,10 +244,28 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Overlord")
     FGameplayTag PatrolAIState;
 
+    // Command bus tags every registered guard is subscribed to
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Overlord")
+    FGameplayTagContainer DefaultGuardCommands;
+
 private:
+    // Subscribers of one command tag, with a spatial grid over them rebuilt at most once per frame
+    struct FCommandBucket {
+        TArray<TWeakObjectPtr<AACFAIController>> Subscribers;
+        TMap<FIntPoint, TArray<int32>> Cells;
+        uint64 CellsFrame = MAX_uint64;
+    };
+
+    static constexpr float CommandCellSize = 1000.0f;
+
+    TMap<FGameplayTag, FCommandBucket> CommandBuckets;
+    TArray<FPortalAICommand> PendingCommands;
+    TArray<AACFAIController*> CommandRecipients;
+
     // Timers
     FTimerHandle AnalysisTimer;
     FTimerHandle PlayerTrackingTimer;
+    FTimerHandle CommandDispatchTimer;
 
     // Internal Functions
     void StartContinuousAnalysis();
@@ -249,6 +276,13 @@ private:
     void CleanupInvalidAI();
     void AnalyzePlayerBehaviorPatterns();
 
+    // Command Bus
+    void DispatchPendingCommands();
+    void GatherCommandRecipients(FCommandBucket& Bucket, const FPortalAICommand& Command);
+    void DeliverCommand(AACFAIController* AIController, const FPortalAICommand& Command);
+    static void RefreshBucketCells(FCommandBucket& Bucket);
+    static FIntPoint GetCommandCell(const FVector& Location);
+
     // ACF Integration
     void SetACFPatrolBehavior(AACFAIController* AIController, const FACFAIUpgradeData& UpgradeData);
     void SendACFCommand(AACFAIController* AIController, const FGameplayTag& CommandTag);
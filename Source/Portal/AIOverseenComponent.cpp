@@ -230,8 +230,10 @@ void UAIOverseenComponent::SetPortalDefenseMode(bool bDefendPortalValue)
 void UAIOverseenComponent::AlertToPlayerPresence(FVector PlayerLocation)
 {
     if (APortalDefenseAIController* PatrolAI = Cast<APortalDefenseAIController>(ACFAIController)) {
-        TArray<FVector> AlertParams = { PlayerLocation };
-        PatrolAI->ReceiveOverlordCommand("InvestigateAlert", AlertParams);
+        FPortalAICommand Command;
+        Command.CommandTag = FPortalAICommandTags::Get().Investigate;
+        Command.Location = PlayerLocation;
+        PatrolAI->ReceiveOverlordCommand(Command);
 
         // Alert overlord about player presence
         if (UAIOverlordManager* Overlord = UAIOverlordManager::GetInstance(GetWorld())) {
@@ -8,6 +8,7 @@
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "PortalDefenseAIController.h" // Include here instead of in header
+#include "PortalPlayerModelSubsystem.h"
 #include "TimerManager.h"
 
 UEliteAIIntelligenceComponent::UEliteAIIntelligenceComponent()
@@ -51,6 +52,8 @@ void UEliteAIIntelligenceComponent::BeginPlay()
         OwnerPawn = OwnerController->GetPawn();
     }
 
+    PlayerModelService = UPortalPlayerModelSubsystem::GetInstance(this);
+
     // Initialize elite mode if enabled
     if (bEliteModeEnabled) {
         ApplyDifficultySettings();
@@ -75,9 +78,7 @@ void UEliteAIIntelligenceComponent::TickComponent(float DeltaTime, ELevelTick Ti
         return;
     }
 
-    // Update player pattern analysis
-    UpdatePlayerPattern();
-
+    // Player patterns are sampled once per player by UPortalPlayerModelSubsystem
     // Update predictions
     UpdatePredictions();
 
@@ -132,9 +133,8 @@ void UEliteAIIntelligenceComponent::StartPlayerTracking(APawn* Player)
     TrackedPlayer = Player;
     bIsTrackingPlayer = true;
     TrackingStartTime = GetWorld()->GetTimeSeconds();
-
-    // Reset pattern data
-    CurrentPlayerPattern = FPlayerBehaviorPattern();
+    PlayerEngagementDistance = 0.0f;
+    ObservedAttackCount = 0;
 
     UE_LOG(LogTemp, Log, TEXT("Elite AI started tracking player: %s"), *Player->GetName());
 }
@@ -148,70 +148,42 @@ void UEliteAIIntelligenceComponent::StopPlayerTracking()
 
 void UEliteAIIntelligenceComponent::RecordPlayerPosition(const FVector& Position)
 {
-    if (!bIsTrackingPlayer || CurrentSettings.PatternAnalysisDepth <= 0.0f) {
+    if (!bIsTrackingPlayer || !PlayerModelService) {
         return;
     }
 
-    CurrentPlayerPattern.RecentPositions.Add(Position);
-
-    // Keep only recent positions (based on analysis depth)
-    int32 MaxPositions = FMath::FloorToInt(CurrentSettings.PatternAnalysisDepth);
-    if (CurrentPlayerPattern.RecentPositions.Num() > MaxPositions) {
-        CurrentPlayerPattern.RecentPositions.RemoveAt(0);
-    }
-
-    // Update average movement speed
-    if (CurrentPlayerPattern.RecentPositions.Num() >= 2) {
-        FVector LastPos = CurrentPlayerPattern.RecentPositions[CurrentPlayerPattern.RecentPositions.Num() - 2];
-        float Distance = FVector::Dist(Position, LastPos);
-        float DeltaTime = 0.1f; // Assuming 10 FPS tick rate
-        float Speed = Distance / DeltaTime;
-
-        CurrentPlayerPattern.AverageMovementSpeed = (CurrentPlayerPattern.AverageMovementSpeed + Speed) * 0.5f;
-    }
+    PlayerModelService->RecordPlayerPosition(TrackedPlayer, Position);
 }
 
 void UEliteAIIntelligenceComponent::RecordPlayerAttack(const FVector& AttackPosition, float Timing)
 {
-    if (!bIsTrackingPlayer) {
+    if (!bIsTrackingPlayer || !PlayerModelService) {
         return;
     }
 
-    CurrentPlayerPattern.AttackPositions.Add(AttackPosition);
-    CurrentPlayerPattern.AttackTimings.Add(Timing);
+    PlayerModelService->RecordPlayerAttack(TrackedPlayer, AttackPosition, Timing);
 
-    // Calculate attack frequency
-    if (CurrentPlayerPattern.AttackTimings.Num() >= 2) {
-        float TimeDiff = CurrentPlayerPattern.AttackTimings.Last() - CurrentPlayerPattern.AttackTimings[CurrentPlayerPattern.AttackTimings.Num() - 2];
-        CurrentPlayerPattern.AttackFrequency = 1.0f / FMath::Max(TimeDiff, 0.1f);
-    }
-
-    // Update preferred engagement distance
-    if (OwnerPawn && CurrentPlayerPattern.AttackPositions.Num() > 0) {
-        float TotalDistance = 0.0f;
-        for (const FVector& Pos : CurrentPlayerPattern.AttackPositions) {
-            TotalDistance += FVector::Dist(OwnerPawn->GetActorLocation(), Pos);
-        }
-        CurrentPlayerPattern.PreferredEngagementDistance = TotalDistance / CurrentPlayerPattern.AttackPositions.Num();
+    if (OwnerPawn) {
+        const float Distance = FVector::Dist(OwnerPawn->GetActorLocation(), AttackPosition);
+        ObservedAttackCount++;
+        PlayerEngagementDistance = ObservedAttackCount == 1 ? Distance : FMath::Lerp(PlayerEngagementDistance, Distance, PlayerModelService->GetSmoothingFactor());
     }
 }
 
 void UEliteAIIntelligenceComponent::RecordPlayerDodge(const FVector& DodgeDirection)
 {
-    if (!bIsTrackingPlayer) {
+    if (!bIsTrackingPlayer || !PlayerModelService) {
         return;
     }
 
-    CurrentPlayerPattern.DodgeDirections.Add(DodgeDirection);
+    PlayerModelService->RecordPlayerDodge(TrackedPlayer, DodgeDirection);
+}
 
-    // Calculate preferred dodge direction
-    if (CurrentPlayerPattern.DodgeDirections.Num() > 0) {
-        FVector TotalDirection = FVector::ZeroVector;
-        for (const FVector& Dir : CurrentPlayerPattern.DodgeDirections) {
-            TotalDirection += Dir;
-        }
-        CurrentPlayerPattern.PreferredDodgeDirection = TotalDirection / CurrentPlayerPattern.DodgeDirections.Num();
-    }
+FPlayerBehaviorPattern UEliteAIIntelligenceComponent::GetCurrentPlayerPattern() const
+{
+    FPlayerBehaviorPattern Pattern = PlayerModelService ? PlayerModelService->BuildBehaviorPattern(TrackedPlayer) : FPlayerBehaviorPattern();
+    Pattern.PreferredEngagementDistance = PlayerEngagementDistance;
+    return Pattern;
 }
 
 // Prediction Functions
@@ -223,16 +195,16 @@ FVector UEliteAIIntelligenceComponent::PredictPlayerPosition(float PredictionTim
 
     FVector CurrentPos = TrackedPlayer->GetActorLocation();
     FVector CurrentVel = TrackedPlayer->GetVelocity();
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
 
     // Basic linear prediction
     FVector BasicPrediction = CurrentPos + (CurrentVel * PredictionTime);
 
     // Enhanced prediction based on difficulty
-    if (CurrentSettings.PredictionAccuracy > 0.5f && CurrentPlayerPattern.RecentPositions.Num() > 3) {
-        // Acceleration-based prediction
-        FVector LastVel = (CurrentPlayerPattern.RecentPositions.Last() - CurrentPlayerPattern.RecentPositions[CurrentPlayerPattern.RecentPositions.Num() - 2]) / (1.0f / 60.0f);
-
-        FVector Acceleration = (CurrentVel - LastVel) / (1.0f / 60.0f);
+    if (CurrentSettings.PredictionAccuracy > 0.5f && Model && Model->RecentPositions.Num() > 3) {
+        // Acceleration-based prediction against the velocity of the last model sample
+        const float SampleInterval = PlayerModelService->GetSampleInterval();
+        FVector Acceleration = (CurrentVel - Model->SampleVelocity) / SampleInterval;
 
         // Kinematic prediction: pos = pos0 + vel*t + 0.5*acc*t^2
         CachedPlayerPositionPrediction = CurrentPos + (CurrentVel * PredictionTime) + (0.5f * Acceleration * PredictionTime * PredictionTime);
@@ -241,7 +213,7 @@ FVector UEliteAIIntelligenceComponent::PredictPlayerPosition(float PredictionTim
     }
 
     // Pattern-based trajectory modification
-    if (CurrentSettings.bCanCounterAdapt && CurrentPlayerPattern.bPrefersCircleStrafing) {
+    if (CurrentSettings.bCanCounterAdapt && Model && Model->bPrefersCircleStrafing && OwnerPawn) {
         // Predict circular movement
         float AngularVelocity = 2.0f; // Radians per second - could be learned
         FVector ToPlayer = CurrentPos - OwnerPawn->GetActorLocation();
@@ -268,16 +240,9 @@ bool UEliteAIIntelligenceComponent::ShouldPredictDodge(const FVector& AttackDire
     }
 
     // Check if player has consistent dodge patterns
-    if (CurrentPlayerPattern.DodgeDirections.Num() >= 3) {
-        // Calculate pattern consistency
-        float DotSum = 0.0f;
-        for (int32 i = 0; i < CurrentPlayerPattern.DodgeDirections.Num() - 1; ++i) {
-            DotSum += FVector::DotProduct(CurrentPlayerPattern.DodgeDirections[i],
-                CurrentPlayerPattern.DodgeDirections[i + 1]);
-        }
-        float Consistency = DotSum / (CurrentPlayerPattern.DodgeDirections.Num() - 1);
-
-        return Consistency > 0.5f; // 50% consistency threshold
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    if (Model && Model->DodgeCount >= 3) {
+        return Model->DodgeConsistency > 0.5f; // 50% consistency threshold
     }
 
     return false;
@@ -290,9 +255,7 @@ void UEliteAIIntelligenceComponent::AdaptToPlayerBehavior()
         return;
     }
 
-    AnalyzePlayerMovement();
-    AnalyzePlayerCombat();
-
+    // Movement and combat analysis is kept current by the shared model service
     // Set adaptation cooldown
     AdaptationCooldown = 5.0f / CurrentSettings.AdaptationSpeed;
 
@@ -301,44 +264,50 @@ void UEliteAIIntelligenceComponent::AdaptToPlayerBehavior()
 
 void UEliteAIIntelligenceComponent::CounterPlayerStrategy()
 {
-    if (!CurrentSettings.bCanCounterAdapt || !bIsTrackingPlayer) {
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    if (!CurrentSettings.bCanCounterAdapt || !bIsTrackingPlayer || !Model) {
         return;
     }
 
     // Counter circle strafing
-    if (CurrentPlayerPattern.bPrefersCircleStrafing) {
+    if (Model->bPrefersCircleStrafing) {
         // Implement counter-strafing or prediction
         if (OwnerController) {
-            OwnerController->ReceiveOverlordCommand("CounterStrafe",
-                TArray<FVector> { CurrentPlayerPattern.PreferredDodgeDirection });
+            FPortalAICommand Command;
+            Command.CommandTag = FPortalAICommandTags::Get().CounterStrafe;
+            Command.Direction = Model->DodgeDirectionMean;
+            OwnerController->ReceiveOverlordCommand(Command);
         }
     }
 
     // Counter cover usage
-    if (CurrentPlayerPattern.bUsesEnvironmentCover) {
+    if (Model->bUsesEnvironmentCover) {
         // Implement flanking or area denial
         if (OwnerController) {
-            OwnerController->ReceiveOverlordCommand("FlankCover", TArray<FVector>());
+            FPortalAICommand Command;
+            Command.CommandTag = FPortalAICommandTags::Get().FlankCover;
+            OwnerController->ReceiveOverlordCommand(Command);
         }
     }
 }
 
 FString UEliteAIIntelligenceComponent::GetRecommendedTactic()
 {
-    if (!bIsTrackingPlayer) {
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    if (!bIsTrackingPlayer || !Model) {
         return "Patrol";
     }
 
     // Analyze current situation and recommend tactics
-    float EngagementDistance = CurrentPlayerPattern.PreferredEngagementDistance;
+    float EngagementDistance = PlayerEngagementDistance;
 
     if (EngagementDistance < 500.0f) {
         return "CloseQuarters";
     } else if (EngagementDistance > 1500.0f) {
         return "LongRange";
-    } else if (CurrentPlayerPattern.bPrefersCircleStrafing) {
+    } else if (Model->bPrefersCircleStrafing) {
         return "CounterStrafe";
-    } else if (CurrentPlayerPattern.bUsesEnvironmentCover) {
+    } else if (Model->bUsesEnvironmentCover) {
         return "FlankingManeuver";
     }
 
@@ -365,12 +334,13 @@ void UEliteAIIntelligenceComponent::RecordTacticSuccess(const FString& TacticNam
 // Combat Intelligence
 float UEliteAIIntelligenceComponent::CalculateOptimalEngagementDistance()
 {
-    if (!bIsTrackingPlayer) {
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    if (!bIsTrackingPlayer || !Model) {
         return 1000.0f; // Default engagement distance
     }
 
     // Factor in player's preferred engagement distance
-    float PlayerPreference = CurrentPlayerPattern.PreferredEngagementDistance;
+    float PlayerPreference = PlayerEngagementDistance;
 
     // Counter player preference
     if (CurrentSettings.bCanCounterAdapt) {
@@ -397,7 +367,8 @@ FVector UEliteAIIntelligenceComponent::CalculateOptimalAttackPosition(const FVec
     FVector BasePosition = PlayerPosition - (ToPlayer * OptimalDistance);
 
     // Add tactical offset based on player patterns
-    if (CurrentPlayerPattern.bPrefersCircleStrafing) {
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    if (Model && Model->bPrefersCircleStrafing) {
         // Position to intercept strafing
         FVector PerpendicularOffset = FVector::CrossProduct(ToPlayer, FVector::UpVector) * 200.0f;
         BasePosition += PerpendicularOffset;
@@ -408,9 +379,10 @@ FVector UEliteAIIntelligenceComponent::CalculateOptimalAttackPosition(const FVec
 
 bool UEliteAIIntelligenceComponent::ShouldUseFlankingManeuver()
 {
-    if (CurrentSettings.bCanCounterAdapt && bIsTrackingPlayer) {
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    if (CurrentSettings.bCanCounterAdapt && bIsTrackingPlayer && Model) {
         // Use flanking if player uses cover frequently
-        return CurrentPlayerPattern.bUsesEnvironmentCover;
+        return Model->bUsesEnvironmentCover;
     }
 
     return false;
@@ -431,7 +403,7 @@ void UEliteAIIntelligenceComponent::UpdateEliteSettings()
 
 void UEliteAIIntelligenceComponent::ResetBehaviorPatterns()
 {
-    CurrentPlayerPattern = FPlayerBehaviorPattern();
+    // The player model itself is shared with other guards and is not reset here
     TacticSuccessRates.Empty();
     RecentTactics.Empty();
     AdaptationCooldown = 0.0f;
@@ -439,19 +411,6 @@ void UEliteAIIntelligenceComponent::ResetBehaviorPatterns()
 }
 
 // Private Helper Functions
-void UEliteAIIntelligenceComponent::UpdatePlayerPattern()
-{
-    if (!TrackedPlayer) {
-        return;
-    }
-
-    // Record current position
-    RecordPlayerPosition(TrackedPlayer->GetActorLocation());
-
-    // Analyze movement patterns
-    AnalyzePlayerMovement();
-}
-
 void UEliteAIIntelligenceComponent::UpdatePredictions()
 {
     if (!bIsTrackingPlayer || CurrentSettings.PredictionAccuracy <= 0.0f) {
@@ -477,63 +436,6 @@ void UEliteAIIntelligenceComponent::UpdateAdaptation()
     }
 }
 
-void UEliteAIIntelligenceComponent::AnalyzePlayerMovement()
-{
-    if (CurrentPlayerPattern.RecentPositions.Num() < 5) {
-        return;
-    }
-
-    // Detect circle strafing
-    float CircularityScore = 0.0f;
-    FVector CenterPoint = FVector::ZeroVector;
-
-    // Calculate approximate center
-    for (const FVector& Pos : CurrentPlayerPattern.RecentPositions) {
-        CenterPoint += Pos;
-    }
-    CenterPoint /= CurrentPlayerPattern.RecentPositions.Num();
-
-    // Check if movement forms circular pattern
-    float AvgDistance = 0.0f;
-    for (const FVector& Pos : CurrentPlayerPattern.RecentPositions) {
-        AvgDistance += FVector::Dist(Pos, CenterPoint);
-    }
-    AvgDistance /= CurrentPlayerPattern.RecentPositions.Num();
-
-    float DistanceVariance = 0.0f;
-    for (const FVector& Pos : CurrentPlayerPattern.RecentPositions) {
-        float Diff = FVector::Dist(Pos, CenterPoint) - AvgDistance;
-        DistanceVariance += Diff * Diff;
-    }
-    DistanceVariance /= CurrentPlayerPattern.RecentPositions.Num();
-
-    // Low variance in distance from center indicates circular movement
-    CurrentPlayerPattern.bPrefersCircleStrafing = (DistanceVariance < 10000.0f && AvgDistance > 300.0f);
-}
-
-void UEliteAIIntelligenceComponent::AnalyzePlayerCombat()
-{
-    // Analyze combat patterns based on attack positions and timings
-    if (CurrentPlayerPattern.AttackPositions.Num() >= 3) {
-        // Check if player uses cover (attacks from similar positions)
-        float PositionVariance = 0.0f;
-        FVector AvgAttackPos = FVector::ZeroVector;
-
-        for (const FVector& Pos : CurrentPlayerPattern.AttackPositions) {
-            AvgAttackPos += Pos;
-        }
-        AvgAttackPos /= CurrentPlayerPattern.AttackPositions.Num();
-
-        for (const FVector& Pos : CurrentPlayerPattern.AttackPositions) {
-            PositionVariance += FVector::DistSquared(Pos, AvgAttackPos);
-        }
-        PositionVariance /= CurrentPlayerPattern.AttackPositions.Num();
-
-        // Low variance indicates consistent cover usage
-        CurrentPlayerPattern.bUsesEnvironmentCover = (PositionVariance < 250000.0f);
-    }
-}
-
 void UEliteAIIntelligenceComponent::ApplyDifficultySettings()
 {
     // Configure settings based on difficulty level
@@ -652,26 +554,11 @@ bool UEliteAIIntelligenceComponent::IsPlayerBehaviorConsistent() const
 
 float UEliteAIIntelligenceComponent::CalculatePatternConfidence() const
 {
-    if (CurrentPlayerPattern.RecentPositions.Num() < 5) {
-        return 0.0f;
-    }
-
-    float Confidence = 0.0f;
-
-    // Factor in position consistency
-    if (CurrentPlayerPattern.bPrefersCircleStrafing || CurrentPlayerPattern.bUsesEnvironmentCover) {
-        Confidence += 0.3f;
-    }
-
-    // Factor in attack pattern consistency
-    if (CurrentPlayerPattern.AttackPositions.Num() >= 3) {
-        Confidence += 0.3f;
-    }
-
-    // Factor in dodge pattern consistency
-    if (CurrentPlayerPattern.DodgeDirections.Num() >= 3) {
-        Confidence += 0.4f;
-    }
+    const FPortalPlayerModel* Model = GetTrackedPlayerModel();
+    return Model ? Model->GetPatternConfidence() : 0.0f;
+}
 
-    return FMath::Clamp(Confidence, 0.0f, 1.0f);
-}
\ No newline at end of file
+const FPortalPlayerModel* UEliteAIIntelligenceComponent::GetTrackedPlayerModel() const
+{
+    return PlayerModelService ? PlayerModelService->GetPlayerModel(TrackedPlayer) : nullptr;
+}
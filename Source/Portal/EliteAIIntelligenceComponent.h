@@ -14,6 +14,8 @@
 
 // Forward Declarations
 class APortalDefenseAIController; // Forward declaration instead of include
+class UPortalPlayerModelSubsystem;
+struct FPortalPlayerModel;
 
 UENUM(BlueprintType)
 enum class EEliteDifficultyLevel : uint8 {
@@ -176,8 +178,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Player Analysis")
     void RecordPlayerDodge(const FVector& DodgeDirection);
 
+    // Snapshot of the shared model for the tracked player
     UFUNCTION(BlueprintPure, Category = "Player Analysis")
-    FPlayerBehaviorPattern GetCurrentPlayerPattern() const { return CurrentPlayerPattern; }
+    FPlayerBehaviorPattern GetCurrentPlayerPattern() const;
 
     // Prediction Functions
     UFUNCTION(BlueprintCallable, Category = "Prediction")
@@ -256,15 +259,19 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Player Tracking")
     TObjectPtr<APawn> TrackedPlayer;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Player Tracking")
-    FPlayerBehaviorPattern CurrentPlayerPattern;
-
     UPROPERTY(BlueprintReadOnly, Category = "Player Tracking")
     float TrackingStartTime = 0.0f;
 
     UPROPERTY(BlueprintReadOnly, Category = "Player Tracking")
     bool bIsTrackingPlayer = false;
 
+    // Average distance between the player attacks and this guard, not shared with the other guards
+    UPROPERTY(BlueprintReadOnly, Category = "Player Tracking")
+    float PlayerEngagementDistance = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Tracking")
+    int32 ObservedAttackCount = 0;
+
     // Prediction Data
     UPROPERTY(BlueprintReadOnly, Category = "Prediction")
     FVector CachedPlayerPositionPrediction = FVector::ZeroVector;
@@ -292,15 +299,17 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "References")
     TObjectPtr<APawn> OwnerPawn;
 
+    // Shared per-player model, owned by the world
+    UPROPERTY(BlueprintReadOnly, Category = "References")
+    TObjectPtr<UPortalPlayerModelSubsystem> PlayerModelService;
+
 private:
     // Internal Update Functions
-    void UpdatePlayerPattern();
     void UpdatePredictions();
     void UpdateAdaptation();
-    void AnalyzePlayerMovement();
-    void AnalyzePlayerCombat();
     void ApplyDifficultySettings();
     void CachePredictions();
     bool IsPlayerBehaviorConsistent() const;
     float CalculatePatternConfidence() const;
+    const FPortalPlayerModel* GetTrackedPlayerModel() const;
 };
\ No newline at end of file
@@ -0,0 +1,33 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Game-thread copy of everything a batched guard update reads.
+ * Plain data only, so worker threads can compute on it without touching any UObject.
+ */
+struct FPortalAIBatchSnapshot {
+    FVector PawnLocation = FVector::ZeroVector;
+    FVector PatrolCenter = FVector::ZeroVector;
+    FVector CurrentPatrolTarget = FVector::ZeroVector;
+    FVector CombatTargetLocation = FVector::ZeroVector;
+    float PatrolRadius = 400.0f;
+    float PatrolAngle = 0.0f;
+    float AttackRange = 800.0f;
+    bool bIsPatrolling = false;
+    bool bClockwisePatrol = true;
+    bool bHasCombatTarget = false;
+};
+
+/**
+ * Output of the parallel compute phase, applied back to the controller on the game thread.
+ */
+struct FPortalAIBatchResult {
+    FVector NewPatrolTarget = FVector::ZeroVector;
+    float NewPatrolAngle = 0.0f;
+    float DistanceToCombatTarget = 0.0f;
+    bool bIssuePatrolMove = false;
+    bool bCombatTargetInRange = false;
+};
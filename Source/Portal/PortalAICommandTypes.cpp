@@ -0,0 +1,11 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "PortalAICommandTypes.h"
+
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_Investigate, "AI.Commands.Investigate");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_IncreaseAggression, "AI.Commands.IncreaseAggression");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_IncreaseDetectionRange, "AI.Commands.IncreaseDetectionRange");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_AdaptToPlayerRoutes, "AI.Commands.AdaptToPlayerRoutes");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_ReinforceArea, "AI.Commands.ReinforceArea");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_CounterStrafe, "AI.Commands.CounterStrafe");
+UE_DEFINE_GAMEPLAY_TAG(TAG_AI_Commands_FlankCover, "AI.Commands.FlankCover");
@@ -0,0 +1,79 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "NativeGameplayTags.h"
+#include "PortalAICommandTypes.generated.h"
+
+// Registered natively, so they are valid before the config tags load and inside CDO constructors
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_Investigate);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_IncreaseAggression);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_IncreaseDetectionRange);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_AdaptToPlayerRoutes);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_ReinforceArea);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_CounterStrafe);
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_AI_Commands_FlankCover);
+
+/**
+ * Overlord command sent through the UAIOverlordManager command bus.
+ * Keyed by tag with a fixed-size payload, so queuing and dispatching never allocates per recipient.
+ */
+USTRUCT(BlueprintType)
+struct FPortalAICommand {
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Command")
+    FGameplayTag CommandTag;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Command")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Command")
+    FVector Direction = FVector::ZeroVector;
+
+    // Only guards within Radius of Location receive the command, 0 for every subscriber
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Command")
+    float Radius = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Command")
+    float Magnitude = 1.0f;
+
+    // 0 for no limit
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Command")
+    int32 MaxRecipients = 0;
+
+    bool IsSpatial() const { return Radius > 0.0f; }
+};
+
+/**
+ * Command tags understood by APortalDefenseAIController.
+ */
+struct FPortalAICommandTags {
+    FGameplayTag Investigate;
+    FGameplayTag IncreaseAggression;
+    FGameplayTag IncreaseDetectionRange;
+    FGameplayTag AdaptToPlayerRoutes;
+    FGameplayTag ReinforceArea;
+    FGameplayTag CounterStrafe;
+    FGameplayTag FlankCover;
+
+    static const FPortalAICommandTags& Get()
+    {
+        static const FPortalAICommandTags Tags;
+        return Tags;
+    }
+
+private:
+    FPortalAICommandTags()
+    {
+        Investigate = TAG_AI_Commands_Investigate;
+        IncreaseAggression = TAG_AI_Commands_IncreaseAggression;
+        IncreaseDetectionRange = TAG_AI_Commands_IncreaseDetectionRange;
+        AdaptToPlayerRoutes = TAG_AI_Commands_AdaptToPlayerRoutes;
+        ReinforceArea = TAG_AI_Commands_ReinforceArea;
+        CounterStrafe = TAG_AI_Commands_CounterStrafe;
+        FlankCover = TAG_AI_Commands_FlankCover;
+    }
+};
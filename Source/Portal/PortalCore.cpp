@@ -35,6 +35,16 @@ APortalCore::APortalCore()
     InteractionSphere->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
     InteractionSphere->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
 
+    // Create Capture Zone
+    CaptureZone = CreateDefaultSubobject<USphereComponent>(TEXT("CaptureZone"));
+    CaptureZone->SetupAttachment(RootComponent);
+    CaptureZone->SetSphereRadius(500.0f);
+    CaptureZone->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    CaptureZone->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
+    CaptureZone->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+    CaptureZone->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
+    CaptureZone->SetGenerateOverlapEvents(true);
+
     // Create Health Widget
     HealthWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("HealthWidget"));
     HealthWidget->SetupAttachment(RootComponent);
@@ -61,6 +71,9 @@ APortalCore::APortalCore()
     InteractionRange = 300.0f;
     InteractableName = FText::FromString("Portal");
 
+    // Capture Properties
+    CaptureZoneRadius = 500.0f;
+
     // Visual Properties
     HealthyColor = FLinearColor::Green;
     DamagedColor = FLinearColor::Yellow;
@@ -72,6 +85,7 @@ void APortalCore::BeginPlay()
     Super::BeginPlay();
 
     CurrentHealth = MaxHealth;
+    CaptureZone->SetSphereRadius(CaptureZoneRadius);
     UpdateVisualState();
 }
 
@@ -211,10 +225,24 @@ FLinearColor APortalCore::GetHealthBasedColor() const
     }
 }
 
+void APortalCore::SetCaptureZoneRadius(float NewRadius)
+{
+    if (HasAuthority()) {
+        CaptureZoneRadius = FMath::Max(NewRadius, 0.0f);
+        OnRep_CaptureZoneRadius();
+    }
+}
+
+void APortalCore::OnRep_CaptureZoneRadius()
+{
+    CaptureZone->SetSphereRadius(CaptureZoneRadius);
+}
+
 void APortalCore::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
     DOREPLIFETIME(APortalCore, MaxHealth);
     DOREPLIFETIME(APortalCore, CurrentHealth);
+    DOREPLIFETIME(APortalCore, CaptureZoneRadius);
 }
\ No newline at end of file
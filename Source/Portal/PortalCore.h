@@ -90,6 +90,16 @@ public:
     UFUNCTION(BlueprintPure, Category = "Interaction")
     bool CanInteract() const { return !bIsDestroyed && bCanInteract; }
 
+    // Capture Zone
+    UFUNCTION(BlueprintPure, Category = "Capture")
+    USphereComponent* GetCaptureZone() const { return CaptureZone; }
+
+    UFUNCTION(BlueprintCallable, Category = "Capture")
+    void SetCaptureZoneRadius(float NewRadius);
+
+    UFUNCTION(BlueprintPure, Category = "Capture")
+    float GetCaptureZoneRadius() const { return CaptureZoneRadius; }
+
     // Visual Effects
     UFUNCTION(BlueprintImplementableEvent, Category = "Effects")
     void PlayDamageEffect();
@@ -115,6 +125,10 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     TObjectPtr<USphereComponent> InteractionSphere;
 
+    // Pawns overlapping this volume are the capture zone occupants
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    TObjectPtr<USphereComponent> CaptureZone;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     TObjectPtr<UWidgetComponent> HealthWidget;
 
@@ -151,6 +165,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Interaction")
     float InteractionRange;
 
+    // Capture Properties
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Capture", ReplicatedUsing = OnRep_CaptureZoneRadius)
+    float CaptureZoneRadius;
+
     // ACF Interaction Properties
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ACF | Interaction")
     FText InteractableName;
@@ -171,6 +189,9 @@ private:
     void HandleDestruction();
     FLinearColor GetHealthBasedColor() const;
 
+    UFUNCTION()
+    void OnRep_CaptureZoneRadius();
+
     // Networking
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
\ No newline at end of file
@@ -220,6 +220,90 @@ bool APortalDefenseAIController::ShouldActivateEliteSystems() const
 
 // Add other function implementations here...
 
+void APortalDefenseAIController::GatherBatchSnapshot(FPortalAIBatchSnapshot& OutSnapshot) const
+{
+    if (const APawn* ControlledPawn = GetPawn()) {
+        OutSnapshot.PawnLocation = ControlledPawn->GetActorLocation();
+    }
+
+    OutSnapshot.PatrolCenter = PatrolCenter;
+    OutSnapshot.CurrentPatrolTarget = CurrentPatrolTarget;
+    OutSnapshot.PatrolRadius = CurrentAIData.PatrolRadius;
+    OutSnapshot.PatrolAngle = PatrolAngle;
+    OutSnapshot.AttackRange = CurrentAIData.AttackRange;
+    OutSnapshot.bIsPatrolling = bIsPatrolling;
+    OutSnapshot.bClockwisePatrol = bClockwisePatrol;
+    OutSnapshot.bHasCombatTarget = CombatTarget != nullptr;
+    OutSnapshot.CombatTargetLocation = CombatTarget ? CombatTarget->GetActorLocation() : FVector::ZeroVector;
+}
+
+void APortalDefenseAIController::ApplyBatchResult(const FPortalAIBatchResult& Result, bool bUpdateCombat)
+{
+    PatrolAngle = Result.NewPatrolAngle;
+
+    if (Result.bIssuePatrolMove) {
+        CurrentPatrolTarget = Result.NewPatrolTarget;
+        MoveToLocation(CurrentPatrolTarget);
+    }
+
+    if (bUpdateCombat && Result.bCombatTargetInRange) {
+        UpdateCombatBehavior();
+    }
+}
+
+void APortalDefenseAIController::UpdateCombatBehavior()
+{
+    if (!CombatTarget || !GetPawn()) {
+        return;
+    }
+
+    // Attacks are run by the ACF battle state, the target in range is handed over to it
+    if (GetTarget() != CombatTarget) {
+        SetTarget(CombatTarget);
+    }
+
+    const FGameplayTag BattleState = UACFFunctionLibrary::GetAIStateTag(EAIState::EBattle);
+    if (GetAIState() != BattleState) {
+        SetCurrentAIState(BattleState);
+    }
+
+    SetTargetActorDistanceBK(FVector::Dist(GetPawn()->GetActorLocation(), CombatTarget->GetActorLocation()));
+}
+
+void APortalDefenseAIController::ReceiveOverlordCommand(const FPortalAICommand& Command)
+{
+    const FPortalAICommandTags& CommandTags = FPortalAICommandTags::Get();
+
+    if (Command.CommandTag == CommandTags.Investigate) {
+        if (!CombatTarget) {
+            InvestigateLocation(Command.Location);
+        }
+    } else if (Command.CommandTag == CommandTags.IncreaseAggression) {
+        CurrentAIData.AggressionLevel = FMath::Min(CurrentAIData.AggressionLevel + 0.25f * Command.Magnitude, 3.0f);
+    } else if (Command.CommandTag == CommandTags.IncreaseDetectionRange) {
+        CurrentAIData.PlayerDetectionRange = FMath::Min(CurrentAIData.PlayerDetectionRange * 1.1f, BaseAIData.PlayerDetectionRange * 2.0f);
+    } else if (Command.CommandTag == CommandTags.AdaptToPlayerRoutes) {
+        // Move the patrol in front of the portal, facing the player's approach route
+        if (PortalTarget && !CombatTarget) {
+            SetPatrolCenter(PortalTarget->GetActorLocation() - Command.Direction * CurrentAIData.PatrolRadius);
+        }
+    } else if (Command.CommandTag == CommandTags.ReinforceArea) {
+        if (!CombatTarget) {
+            SetPatrolCenter(Command.Location);
+            StartPatrolling();
+        }
+    } else if (Command.CommandTag == CommandTags.CounterStrafe) {
+        // Cut off the player's preferred strafe direction
+        if (CombatTarget) {
+            MoveToLocation(CombatTarget->GetActorLocation() + Command.Direction * CurrentAIData.AttackRange * 0.5f);
+        }
+    } else if (Command.CommandTag == CommandTags.FlankCover) {
+        if (CombatTarget && CurrentAIData.bCanFlank) {
+            ExecuteFlankingManeuver(CombatTarget);
+        }
+    }
+}
+
 // Legacy Compatibility Function Implementations
 void APortalDefenseAIController::ApplyAIUpgrade(const FPortalAIData& NewAIData)
 {
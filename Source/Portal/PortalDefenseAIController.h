@@ -9,6 +9,8 @@
 #include "CoreMinimal.h"
 #include "Engine/TimerHandle.h"
 #include "Game/ACFTypes.h"
+#include "PortalAIBatchTypes.h"
+#include "PortalAICommandTypes.h"
 #include "PortalDefenseAIController.generated.h"
 
 // Forward Declarations
@@ -144,9 +146,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Combat")
     void UpdateCombatBehavior();
 
+    // Batch processing (see UAIBatchProcessor). Both run on the game thread only.
+    void GatherBatchSnapshot(FPortalAIBatchSnapshot& OutSnapshot) const;
+    void ApplyBatchResult(const FPortalAIBatchResult& Result, bool bUpdateCombat);
+
     // AI Overlord Integration
     UFUNCTION(BlueprintCallable, Category = "AI Overlord")
-    void ReceiveOverlordCommand(const FString& Command, const TArray<FVector>& Parameters);
+    void ReceiveOverlordCommand(const FPortalAICommand& Command);
 
     UFUNCTION(BlueprintCallable, Category = "AI Overlord")
     void ReportToOverlord(const FString& ReportType, const FVector& Location);
@@ -1,5 +1,6 @@
 #include "PortalDefenseGameMode.h"
 #include "AIOverlordManager.h"
+#include "Components/SphereComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "PortalCore.h"
@@ -13,12 +14,14 @@ APortalDefenseGameMode::APortalDefenseGameMode()
     CaptureZoneRadius = 500.0f;
     TimeToCapture = 60.0f;
     CaptureProgressDecayRate = 0.5f;
+    CaptureUpdateInterval = 0.25f;
 
     bCaptureActive = false;
     CaptureProgress = 0.0f;
     bPortalCaptured = false;
 
-    PrimaryActorTick.bCanEverTick = true;
+    // Capture is driven by zone overlap events and a low-rate timer
+    PrimaryActorTick.bCanEverTick = false;
 }
 
 void APortalDefenseGameMode::BeginPlay()
@@ -31,13 +34,6 @@ void APortalDefenseGameMode::BeginPlay()
     FindPortalCore();
 }
 
-void APortalDefenseGameMode::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-    CheckPlayersInCaptureZone();
-    UpdateCaptureProgress(DeltaTime);
-}
-
 void APortalDefenseGameMode::PostLogin(APlayerController* NewPlayer)
 {
     Super::PostLogin(NewPlayer);
@@ -52,6 +48,9 @@ void APortalDefenseGameMode::StartCapture(APawn* Player)
         if (!bCaptureActive) {
             bCaptureActive = true;
         }
+
+        SyncCaptureState();
+        EnsureCaptureTimer();
     }
 }
 
@@ -64,6 +63,8 @@ void APortalDefenseGameMode::StopCapture(APawn* Player)
         if (PlayersInZone.Num() == 0) {
             bCaptureActive = false;
         }
+
+        SyncCaptureState();
     }
 }
 
@@ -77,6 +78,9 @@ void APortalDefenseGameMode::CompleteCapture()
     bCaptureActive = false;
     CaptureProgress = 1.0f;
 
+    GetWorldTimerManager().ClearTimer(CaptureUpdateTimer);
+    SyncCaptureState();
+
     // Stop portal spawning
     if (PortalSpawner) {
         PortalSpawner->StopDefenseSpawning();
@@ -87,12 +91,7 @@ void APortalDefenseGameMode::CompleteCapture()
 
 bool APortalDefenseGameMode::IsPlayerInCaptureZone(APawn* Player) const
 {
-    if (!Player || !PortalCore) {
-        return false;
-    }
-
-    float DistanceToPortal = FVector::Dist(Player->GetActorLocation(), PortalCore->GetActorLocation());
-    return DistanceToPortal <= CaptureZoneRadius;
+    return Player && ZoneOccupants.Contains(Player);
 }
 
 void APortalDefenseGameMode::FindPortalCore()
@@ -103,6 +102,7 @@ void APortalDefenseGameMode::FindPortalCore()
 
         // Find the portal's spawner component
         PortalSpawner = PortalCore->FindComponentByClass<UPortalDefenseSpawner>();
+        BindCaptureZone();
         if (PortalSpawner) {
             UE_LOG(LogTemp, Warning, TEXT("Found PortalDefenseSpawner component"));
         } else {
@@ -126,45 +126,127 @@ void APortalDefenseGameMode::UpdateCaptureProgress(float DeltaTime)
 
         if (CaptureProgress >= 1.0f) {
             CompleteCapture();
+            return;
         }
     } else if (CaptureProgress > 0.0f) {
         float ProgressDecrease = CaptureProgressDecayRate * DeltaTime;
         CaptureProgress = FMath::Max(0.0f, CaptureProgress - ProgressDecrease);
         OnCaptureProgress.Broadcast(CaptureProgress);
     }
+
+    SyncCaptureState();
 }
 
-void APortalDefenseGameMode::CheckPlayersInCaptureZone()
+void APortalDefenseGameMode::BindCaptureZone()
 {
-    if (bPortalCaptured) {
+    USphereComponent* CaptureZone = PortalCore ? PortalCore->GetCaptureZone() : nullptr;
+    if (!CaptureZone) {
         return;
     }
 
-    TArray<AActor*> AllPlayers;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), AllPlayers);
+    PortalCore->SetCaptureZoneRadius(CaptureZoneRadius);
+
+    CaptureZone->OnComponentBeginOverlap.AddDynamic(this, &APortalDefenseGameMode::OnCaptureZoneBeginOverlap);
+    CaptureZone->OnComponentEndOverlap.AddDynamic(this, &APortalDefenseGameMode::OnCaptureZoneEndOverlap);
+
+    // Pick up pawns that were already inside before the bindings existed
+    TArray<AActor*> OverlappingPawns;
+    CaptureZone->GetOverlappingActors(OverlappingPawns, APawn::StaticClass());
+    for (AActor* Actor : OverlappingPawns) {
+        ZoneOccupants.Add(Cast<APawn>(Actor));
+    }
+
+    if (ZoneOccupants.Num() > 0) {
+        RefreshPlayersInZone();
+        EnsureCaptureTimer();
+    }
+}
 
-    TArray<TObjectPtr<APawn>> CurrentPlayersInZone;
+void APortalDefenseGameMode::RefreshPlayersInZone()
+{
+    // Only the occupants are visited, a pawn possessed or released while inside is picked up here
+    for (auto It = ZoneOccupants.CreateIterator(); It; ++It) {
+        APawn* Occupant = It->Get();
+        if (!Occupant) {
+            It.RemoveCurrent();
+            continue;
+        }
 
-    for (AActor* Actor : AllPlayers) {
-        if (APawn* Player = Cast<APawn>(Actor)) {
-            if (Player->IsPlayerControlled() && IsPlayerInCaptureZone(Player)) {
-                CurrentPlayersInZone.Add(Player);
+        const bool bIsPlayer = Occupant->IsPlayerControlled();
+        const bool bIsCapturing = PlayersInZone.Contains(Occupant);
 
-                if (!PlayersInZone.Contains(Player)) {
-                    StartCapture(Player);
-                }
-            }
+        if (bIsPlayer && !bIsCapturing) {
+            StartCapture(Occupant);
+        } else if (!bIsPlayer && bIsCapturing) {
+            StopCapture(Occupant);
         }
     }
 
-    TArray<TObjectPtr<APawn>> PlayersToRemove;
-    for (APawn* Player : PlayersInZone) {
-        if (!CurrentPlayersInZone.Contains(Player)) {
-            PlayersToRemove.Add(Player);
+    // Drop players that were destroyed inside the zone
+    for (int32 Index = PlayersInZone.Num() - 1; Index >= 0; --Index) {
+        if (!IsValid(PlayersInZone[Index])) {
+            PlayersInZone.RemoveAt(Index);
         }
     }
 
-    for (APawn* Player : PlayersToRemove) {
-        StopCapture(Player);
+    if (PlayersInZone.Num() == 0 && bCaptureActive) {
+        bCaptureActive = false;
+        SyncCaptureState();
+    }
+}
+
+void APortalDefenseGameMode::SyncCaptureState()
+{
+    if (APortalDefenseGameState* PortalGameState = GetGameState<APortalDefenseGameState>()) {
+        PortalGameState->SetCaptureProgress(CaptureProgress);
+        PortalGameState->SetCapturing(bCaptureActive);
+        PortalGameState->SetPlayersInZone(PlayersInZone.Num());
+    }
+}
+
+void APortalDefenseGameMode::EnsureCaptureTimer()
+{
+    if (!bPortalCaptured && !GetWorldTimerManager().IsTimerActive(CaptureUpdateTimer)) {
+        GetWorldTimerManager().SetTimer(CaptureUpdateTimer, this, &APortalDefenseGameMode::OnCaptureTimer, CaptureUpdateInterval, true);
+    }
+}
+
+void APortalDefenseGameMode::OnCaptureTimer()
+{
+    RefreshPlayersInZone();
+    UpdateCaptureProgress(CaptureUpdateInterval);
+
+    // Idle once the zone is empty and progress has fully decayed
+    if (bPortalCaptured || (ZoneOccupants.Num() == 0 && CaptureProgress <= 0.0f)) {
+        GetWorldTimerManager().ClearTimer(CaptureUpdateTimer);
+    }
+}
+
+void APortalDefenseGameMode::OnCaptureZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    APawn* Pawn = Cast<APawn>(OtherActor);
+    if (!Pawn || bPortalCaptured) {
+        return;
+    }
+
+    ZoneOccupants.Add(Pawn);
+
+    if (Pawn->IsPlayerControlled()) {
+        StartCapture(Pawn);
+    }
+
+    EnsureCaptureTimer();
+}
+
+void APortalDefenseGameMode::OnCaptureZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    APawn* Pawn = Cast<APawn>(OtherActor);
+
+    // A pawn with several overlapping components is still inside until the last one leaves
+    if (!Pawn || (OverlappedComponent && OverlappedComponent->IsOverlappingActor(Pawn))) {
+        return;
     }
-}
\ No newline at end of file
+
+    ZoneOccupants.Remove(Pawn);
+    StopCapture(Pawn);
+}
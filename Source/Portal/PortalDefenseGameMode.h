@@ -9,6 +9,7 @@ class APortalCore;
 class APortalDefenseGameState;
 class UAIOverlordManager;
 class UPortalDefenseSpawner;
+class UPrimitiveComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerEnterCaptureZone, APawn*, Player);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerExitCaptureZone, APawn*, Player);
@@ -24,7 +25,6 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
     virtual void PostLogin(APlayerController* NewPlayer) override;
 
 public:
@@ -78,6 +78,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Capture System")
     float CaptureProgressDecayRate = 0.5f;
 
+    // Seconds between capture progress updates
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Capture System")
+    float CaptureUpdateInterval = 0.25f;
+
     // Portal Reference
     UPROPERTY(BlueprintReadOnly, Category = "Portal")
     TObjectPtr<APortalCore> PortalCore;
@@ -104,8 +108,23 @@ protected:
     bool bPortalCaptured;
 
 private:
+    // Every pawn overlapping the portal capture zone, players and AI alike
+    TSet<TWeakObjectPtr<APawn>> ZoneOccupants;
+
+    FTimerHandle CaptureUpdateTimer;
+
     // Helper Functions
     void FindPortalCore();
+    void BindCaptureZone();
     void UpdateCaptureProgress(float DeltaTime);
-    void CheckPlayersInCaptureZone();
+    void RefreshPlayersInZone();
+    void SyncCaptureState();
+    void EnsureCaptureTimer();
+    void OnCaptureTimer();
+
+    UFUNCTION()
+    void OnCaptureZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnCaptureZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 };
\ No newline at end of file
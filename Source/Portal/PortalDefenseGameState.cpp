@@ -77,30 +77,41 @@ void APortalDefenseGameState::ExtractEnergyFromPortal()
 
 void APortalDefenseGameState::SetCaptureProgress(float Progress)
 {
-    if (HasAuthority()) {
-        float OldProgress = CaptureProgress;
-        CaptureProgress = FMath::Clamp(Progress, 0.0f, 1.0f);
+    const float NewProgress = FMath::Clamp(Progress, 0.0f, 1.0f);
 
-        if (FMath::Abs(CaptureProgress - OldProgress) > 0.01f) {
-            OnCaptureProgressChanged.Broadcast(CaptureProgress);
-        }
+    // Only write on change, so the property is only replicated when progress actually moves
+    if (HasAuthority() && NewProgress != CaptureProgress) {
+        CaptureProgress = NewProgress;
+        OnRep_CaptureProgress();
     }
 }
 
 void APortalDefenseGameState::SetCapturing(bool bCapturing)
 {
-    if (HasAuthority()) {
+    if (HasAuthority() && bIsCapturing != bCapturing) {
         bIsCapturing = bCapturing;
+        OnRep_CaptureStatus();
     }
 }
 
 void APortalDefenseGameState::SetPlayersInZone(int32 PlayerCount)
 {
-    if (HasAuthority()) {
+    if (HasAuthority() && PlayersInCaptureZone != PlayerCount) {
         PlayersInCaptureZone = PlayerCount;
+        OnRep_CaptureStatus();
     }
 }
 
+void APortalDefenseGameState::OnRep_CaptureProgress()
+{
+    OnCaptureProgressChanged.Broadcast(CaptureProgress);
+}
+
+void APortalDefenseGameState::OnRep_CaptureStatus()
+{
+    OnCaptureStatusChanged.Broadcast(bIsCapturing, PlayersInCaptureZone);
+}
+
 float APortalDefenseGameState::GetPortalHealthPercent() const
 {
     if (!PortalCore) {
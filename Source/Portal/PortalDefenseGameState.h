@@ -10,6 +10,7 @@ class APortalCore;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnergyChanged, int32, NewEnergy);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPortalHealthChanged, float, CurrentHealth, float, MaxHealth);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCaptureProgressChanged, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCaptureStatusChanged, bool, bIsCapturing, int32, PlayersInZone);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPatrolGuardCountChanged, int32, GuardCount);
 
 UCLASS()
@@ -89,6 +90,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnCaptureProgressChanged OnCaptureProgressChanged;
 
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnCaptureStatusChanged OnCaptureStatusChanged;
+
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnPatrolGuardCountChanged OnPatrolGuardCountChanged;
 
@@ -107,13 +111,13 @@ protected:
     float EnergyExtractionInterval;
 
     // Capture Information
-    UPROPERTY(BlueprintReadOnly, Category = "Capture", Replicated)
+    UPROPERTY(BlueprintReadOnly, Category = "Capture", ReplicatedUsing = OnRep_CaptureProgress)
     float CaptureProgress;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Capture", Replicated)
+    UPROPERTY(BlueprintReadOnly, Category = "Capture", ReplicatedUsing = OnRep_CaptureStatus)
     bool bIsCapturing;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Capture", Replicated)
+    UPROPERTY(BlueprintReadOnly, Category = "Capture", ReplicatedUsing = OnRep_CaptureStatus)
     int32 PlayersInCaptureZone;
 
     // Portal Reference
@@ -140,6 +144,12 @@ private:
     UFUNCTION()
     void OnGuardDestroyed(AActor* DestroyedActor);
 
+    UFUNCTION()
+    void OnRep_CaptureProgress();
+
+    UFUNCTION()
+    void OnRep_CaptureStatus();
+
     // Networking
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
\ No newline at end of file
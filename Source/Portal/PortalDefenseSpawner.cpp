@@ -1,14 +1,26 @@
 #include "PortalDefenseSpawner.h"
 #include "ACFAIController.h"
+#include "AIBatchProcessor.h"
+#include "AILODManager.h"
 #include "AIOverlordManager.h"
 #include "AIOverseenComponent.h"
+#include "ACFStealthDetectionComponent.h"
+#include "ARSStatisticsComponent.h"
+#include "Actors/ACFCharacter.h"
+#include "BrainComponent.h"
+#include "Components/ACFEquipmentComponent.h"
+#include "Components/ACFRagdollComponent.h"
 #include "Components/ACFTeamManagerComponent.h"
+#include "Components/ACFThreatManagerComponent.h"
+#include "Components/CapsuleComponent.h"
 #include "Engine/World.h"
 #include "Game/ACFFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
+#include "Perception/AIPerceptionComponent.h"
 #include "PortalCore.h"
 #include "PortalDefenseAIController.h"
+#include "PortalStealthContextSubsystem.h"
 
 UPortalDefenseSpawner::UPortalDefenseSpawner()
 {
@@ -21,6 +33,11 @@ UPortalDefenseSpawner::UPortalDefenseSpawner()
     bReplaceDeadGuards = true;
     bSpawningActive = false;
 
+    bUseGuardPool = true;
+    ExtraPooledGuardsPerRing = 1;
+    PrewarmSpawnsPerFrame = 4;
+    DeadGuardReturnDelay = 5.0f;
+
     // 10 Defense Rings Setup
 
     // Ring 1 - Inner Defense
@@ -121,6 +138,7 @@ void UPortalDefenseSpawner::BeginPlay()
 
     InitializePortalReference();
     RegisterWithOverlord();
+    PrewarmGuardPools();
 
     if (bAutoStartOnBeginPlay) {
         // Delay spawn to ensure everything is initialized
@@ -133,8 +151,10 @@ void UPortalDefenseSpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     StopDefenseSpawning();
     DespawnAllGuards();
+    DestroyGuardPools();
 
     GetWorld()->GetTimerManager().ClearTimer(SpawnCheckTimer);
+    GetWorld()->GetTimerManager().ClearTimer(PrewarmTimer);
     for (auto& TimerPair : RespawnTimers) {
         GetWorld()->GetTimerManager().ClearTimer(TimerPair.Value);
     }
@@ -202,18 +222,14 @@ void UPortalDefenseSpawner::SpawnRing(int32 RingIndex)
 
 APawn* UPortalDefenseSpawner::SpawnGuardAtPosition(const FDefenseRingConfig& RingConfig, int32 RingIndex, int32 PositionIndex)
 {
-    FVector RingPosition = GetRingPosition(RingConfig.RingDistance, PositionIndex, RingConfig.GuardsPerRing);
-    FVector SpawnLocation = FindGroundAtPosition(RingPosition);
+    FVector SpawnLocation = GetSlotLocation(RingConfig, RingIndex, PositionIndex);
 
     if (SpawnLocation.IsZero()) {
         UE_LOG(LogTemp, Error, TEXT("Failed to find ground at ring position"));
         return nullptr;
     }
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-    APawn* SpawnedGuard = GetWorld()->SpawnActor<APawn>(RingConfig.GuardClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+    APawn* SpawnedGuard = AcquireGuard(RingConfig, RingIndex, SpawnLocation);
     if (!SpawnedGuard) {
         UE_LOG(LogTemp, Error, TEXT("Failed to spawn guard"));
         return nullptr;
@@ -233,9 +249,6 @@ APawn* UPortalDefenseSpawner::SpawnGuardAtPosition(const FDefenseRingConfig& Rin
 
     ActiveGuards.Add(GuardInfo);
 
-    // Bind destruction event
-    SpawnedGuard->OnDestroyed.AddDynamic(this, &UPortalDefenseSpawner::OnGuardDestroyed);
-
     UE_LOG(LogTemp, Log, TEXT("Spawned guard at ring %d, position %d (%.1f, %.1f, %.1f)"),
         RingIndex, PositionIndex, SpawnLocation.X, SpawnLocation.Y, SpawnLocation.Z);
 
@@ -339,16 +352,80 @@ void UPortalDefenseSpawner::SetupGuardBehavior(APawn* Guard, const FDefenseRingC
 
 void UPortalDefenseSpawner::DespawnAllGuards()
 {
-    for (const FActiveGuardInfo& GuardInfo : ActiveGuards) {
-        if (GuardInfo.GuardPawn && IsValid(GuardInfo.GuardPawn)) {
-            GuardInfo.GuardPawn->Destroy();
-        }
+    // Guards go back to the pool, so a following mass respawn does not spawn anything
+    TArray<FActiveGuardInfo> GuardsToDespawn = MoveTemp(ActiveGuards);
+    ActiveGuards.Reset();
+
+    for (const FActiveGuardInfo& GuardInfo : GuardsToDespawn) {
+        ReturnGuardToRing(GuardInfo.GuardPawn.Get(), GuardInfo.RingIndex);
     }
 
-    ActiveGuards.Empty();
     UE_LOG(LogTemp, Warning, TEXT("Despawned all guards"));
 }
 
+void UPortalDefenseSpawner::PrewarmGuardPools()
+{
+    if (!bUseGuardPool || !PortalCore) {
+        return;
+    }
+
+    RingCaches.SetNum(DefenseRings.Num());
+    PendingPrewarmRings.Reset();
+
+    for (int32 RingIndex = 0; RingIndex < DefenseRings.Num(); RingIndex++) {
+        const FDefenseRingConfig& RingConfig = DefenseRings[RingIndex];
+        if (!RingConfig.GuardClass) {
+            continue;
+        }
+
+        // Trace every slot once, while loading
+        for (int32 PositionIndex = 0; PositionIndex < RingConfig.GuardsPerRing; PositionIndex++) {
+            GetSlotLocation(RingConfig, RingIndex, PositionIndex);
+        }
+
+        const int32 TargetCount = RingConfig.GuardsPerRing + ExtraPooledGuardsPerRing;
+        for (int32 Count = RingCaches[RingIndex].PooledGuards.Num(); Count < TargetCount; Count++) {
+            PendingPrewarmRings.Add(RingIndex);
+        }
+    }
+
+    if (PendingPrewarmRings.Num() > 0) {
+        PrewarmTimer = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UPortalDefenseSpawner::ProcessPrewarmQueue);
+    }
+}
+
+void UPortalDefenseSpawner::ReleaseGuardToPool(APawn* Guard)
+{
+    if (!Guard || !IsValid(Guard)) {
+        return;
+    }
+
+    int32 RingIndex = INDEX_NONE;
+
+    const int32 ActiveIndex = ActiveGuards.IndexOfByPredicate([Guard](const FActiveGuardInfo& GuardInfo) {
+        return GuardInfo.GuardPawn == Guard;
+    });
+    if (ActiveIndex != INDEX_NONE) {
+        RingIndex = ActiveGuards[ActiveIndex].RingIndex;
+        ActiveGuards.RemoveAtSwap(ActiveIndex);
+    } else {
+        RingIndex = DefenseRings.IndexOfByPredicate([Guard](const FDefenseRingConfig& RingConfig) {
+            return RingConfig.GuardClass == Guard->GetClass();
+        });
+    }
+
+    ReturnGuardToRing(Guard, RingIndex);
+}
+
+int32 UPortalDefenseSpawner::GetPooledGuardCount() const
+{
+    int32 PooledCount = 0;
+    for (const FDefenseRingCache& RingCache : RingCaches) {
+        PooledCount += RingCache.PooledGuards.Num();
+    }
+    return PooledCount;
+}
+
 int32 UPortalDefenseSpawner::GetMaxGuardCount() const
 {
     int32 MaxCount = 0;
@@ -446,29 +523,75 @@ void UPortalDefenseSpawner::OnSpawnCheckTimer()
 void UPortalDefenseSpawner::OnGuardDestroyed(AActor* DestroyedActor)
 {
     if (APawn* DestroyedGuard = Cast<APawn>(DestroyedActor)) {
-        // Find and remove the guard from active list
-        for (int32 i = 0; i < ActiveGuards.Num(); i++) {
-            if (ActiveGuards[i].GuardPawn == DestroyedGuard) {
-                FActiveGuardInfo GuardInfo = ActiveGuards[i];
-                ActiveGuards.RemoveAt(i);
-
-                // Schedule respawn if enabled
-                if (bReplaceDeadGuards && bSpawningActive) {
-                    ScheduleGuardRespawn(GuardInfo);
-                }
+        HandleGuardLost(DestroyedGuard);
 
-                UE_LOG(LogTemp, Log, TEXT("Guard destroyed at ring %d, position %d"), GuardInfo.RingIndex, GuardInfo.PositionIndex);
-                break;
-            }
+        for (FDefenseRingCache& RingCache : RingCaches) {
+            RingCache.PooledGuards.Remove(DestroyedGuard);
         }
+    }
+}
 
-        // Notify overlord
-        if (AIOverlord) {
-            AIOverlord->RecordAIDeath(Cast<AACFAIController>(DestroyedGuard->GetController()), DestroyedGuard->GetActorLocation());
-        }
+void UPortalDefenseSpawner::OnGuardDeath(AACFCharacter* DeadCharacter)
+{
+    const int32 RingIndex = DeadCharacter ? HandleGuardLost(DeadCharacter) : INDEX_NONE;
+    if (RingIndex == INDEX_NONE || !bUseGuardPool) {
+        return;
+    }
+
+    // Leave the body in the world for a while, then recycle it
+    FTimerHandle ReturnHandle;
+    FTimerDelegate ReturnDelegate = FTimerDelegate::CreateUObject(this, &UPortalDefenseSpawner::ReturnGuardToRing, TWeakObjectPtr<APawn>(DeadCharacter), RingIndex);
+    GetWorld()->GetTimerManager().SetTimer(ReturnHandle, ReturnDelegate, FMath::Max(DeadGuardReturnDelay, 0.01f), false);
+}
+
+void UPortalDefenseSpawner::ReturnGuardToRing(TWeakObjectPtr<APawn> Guard, int32 RingIndex)
+{
+    APawn* GuardPawn = Guard.Get();
+    if (!GuardPawn) {
+        return;
+    }
+
+    if (!bUseGuardPool || !RingCaches.IsValidIndex(RingIndex)) {
+        GuardPawn->Destroy();
+        return;
+    }
+
+    TArray<TObjectPtr<APawn>>& PooledGuards = RingCaches[RingIndex].PooledGuards;
+    if (!PooledGuards.Contains(GuardPawn)) {
+        DeactivateGuard(GuardPawn);
+        PooledGuards.Add(GuardPawn);
     }
 }
 
+int32 UPortalDefenseSpawner::HandleGuardLost(APawn* Guard)
+{
+    // Find and remove the guard from active list
+    const int32 ActiveIndex = ActiveGuards.IndexOfByPredicate([Guard](const FActiveGuardInfo& GuardInfo) {
+        return GuardInfo.GuardPawn == Guard;
+    });
+
+    if (ActiveIndex == INDEX_NONE) {
+        return INDEX_NONE;
+    }
+
+    FActiveGuardInfo GuardInfo = ActiveGuards[ActiveIndex];
+    ActiveGuards.RemoveAtSwap(ActiveIndex);
+
+    // Schedule respawn if enabled
+    if (bReplaceDeadGuards && bSpawningActive) {
+        ScheduleGuardRespawn(GuardInfo);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Guard lost at ring %d, position %d"), GuardInfo.RingIndex, GuardInfo.PositionIndex);
+
+    // Notify overlord
+    if (AIOverlord) {
+        AIOverlord->RecordAIDeath(Cast<AACFAIController>(Guard->GetController()), Guard->GetActorLocation());
+    }
+
+    return GuardInfo.RingIndex;
+}
+
 void UPortalDefenseSpawner::OnRespawnTimerComplete(FGuid RespawnID, FActiveGuardInfo GuardInfo)
 {
     RespawnTimers.Remove(RespawnID);
@@ -476,4 +599,266 @@ void UPortalDefenseSpawner::OnRespawnTimerComplete(FGuid RespawnID, FActiveGuard
     if (bSpawningActive) {
         SpawnGuardAtPosition(GuardInfo.RingConfig, GuardInfo.RingIndex, GuardInfo.PositionIndex);
     }
-}
\ No newline at end of file
+}
+
+FVector UPortalDefenseSpawner::GetSlotLocation(const FDefenseRingConfig& RingConfig, int32 RingIndex, int32 PositionIndex)
+{
+    // Only slots of the configured rings are cached, custom configs are traced every time
+    const bool bCacheable = DefenseRings.IsValidIndex(RingIndex) && DefenseRings[RingIndex].RingDistance == RingConfig.RingDistance
+        && DefenseRings[RingIndex].GuardsPerRing == RingConfig.GuardsPerRing;
+
+    if (!bCacheable) {
+        return FindGroundAtPosition(GetRingPosition(RingConfig.RingDistance, PositionIndex, RingConfig.GuardsPerRing));
+    }
+
+    RingCaches.SetNum(FMath::Max(RingCaches.Num(), DefenseRings.Num()));
+    TArray<FVector>& SlotLocations = RingCaches[RingIndex].SlotLocations;
+
+    if (SlotLocations.Num() != RingConfig.GuardsPerRing) {
+        SlotLocations.Init(FVector::ZeroVector, RingConfig.GuardsPerRing);
+    }
+
+    if (!SlotLocations.IsValidIndex(PositionIndex)) {
+        return FVector::ZeroVector;
+    }
+
+    if (SlotLocations[PositionIndex].IsZero()) {
+        SlotLocations[PositionIndex] = FindGroundAtPosition(GetRingPosition(RingConfig.RingDistance, PositionIndex, RingConfig.GuardsPerRing));
+    }
+
+    return SlotLocations[PositionIndex];
+}
+
+void UPortalDefenseSpawner::ProcessPrewarmQueue()
+{
+    int32 SpawnsThisFrame = 0;
+
+    while (PendingPrewarmRings.Num() > 0 && SpawnsThisFrame < PrewarmSpawnsPerFrame) {
+        const int32 RingIndex = PendingPrewarmRings.Pop(EAllowShrinking::No);
+        if (!DefenseRings.IsValidIndex(RingIndex) || !RingCaches.IsValidIndex(RingIndex)) {
+            continue;
+        }
+
+        const FDefenseRingConfig& RingConfig = DefenseRings[RingIndex];
+        FDefenseRingCache& RingCache = RingCaches[RingIndex];
+
+        // Park the guard on one of its ring slots, so activation is a short teleport
+        const int32 SlotIndex = RingCache.SlotLocations.Num() > 0 ? RingCache.PooledGuards.Num() % RingCache.SlotLocations.Num() : INDEX_NONE;
+        const FVector ParkLocation = RingCache.SlotLocations.IsValidIndex(SlotIndex) ? RingCache.SlotLocations[SlotIndex] : GetOwner()->GetActorLocation();
+
+        if (APawn* Guard = SpawnPooledGuard(RingConfig, ParkLocation)) {
+            DeactivateGuard(Guard);
+            RingCache.PooledGuards.Add(Guard);
+        }
+
+        SpawnsThisFrame++;
+    }
+
+    if (PendingPrewarmRings.Num() > 0) {
+        PrewarmTimer = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UPortalDefenseSpawner::ProcessPrewarmQueue);
+    } else {
+        UE_LOG(LogTemp, Log, TEXT("Portal Defense guard pools ready - %d guards pooled"), GetPooledGuardCount());
+    }
+}
+
+APawn* UPortalDefenseSpawner::AcquireGuard(const FDefenseRingConfig& RingConfig, int32 RingIndex, const FVector& SpawnLocation)
+{
+    if (bUseGuardPool && RingCaches.IsValidIndex(RingIndex)) {
+        TArray<TObjectPtr<APawn>>& PooledGuards = RingCaches[RingIndex].PooledGuards;
+
+        while (PooledGuards.Num() > 0) {
+            APawn* Guard = PooledGuards.Pop(EAllowShrinking::No);
+            if (Guard && IsValid(Guard) && Guard->GetClass() == RingConfig.GuardClass) {
+                ActivateGuard(Guard, SpawnLocation);
+                return Guard;
+            }
+
+            // Wrong class for this config (ring was reconfigured), let it go
+            if (Guard && IsValid(Guard)) {
+                Guard->Destroy();
+            }
+        }
+    }
+
+    // Pool empty or disabled, fall back to a regular spawn
+    return SpawnPooledGuard(RingConfig, SpawnLocation);
+}
+
+APawn* UPortalDefenseSpawner::SpawnPooledGuard(const FDefenseRingConfig& RingConfig, const FVector& SpawnLocation)
+{
+    if (!RingConfig.GuardClass) {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    APawn* Guard = GetWorld()->SpawnActor<APawn>(RingConfig.GuardClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+    if (!Guard) {
+        return nullptr;
+    }
+
+    // Bound once for the whole lifetime of the actor, pooled guards keep their bindings
+    Guard->OnDestroyed.AddUniqueDynamic(this, &UPortalDefenseSpawner::OnGuardDestroyed);
+
+    // Guards with bAutoDestroyOnDeath are destroyed before they can be recycled and simply fall back to spawning
+    if (AACFCharacter* Character = Cast<AACFCharacter>(Guard)) {
+        Character->OnDeath.AddUniqueDynamic(this, &UPortalDefenseSpawner::OnGuardDeath);
+    }
+
+    return Guard;
+}
+
+void UPortalDefenseSpawner::ActivateGuard(APawn* Guard, const FVector& SpawnLocation)
+{
+    Guard->SetActorLocationAndRotation(SpawnLocation, FRotator::ZeroRotator, false, nullptr, ETeleportType::ResetPhysics);
+    Guard->SetActorHiddenInGame(false);
+    Guard->SetActorEnableCollision(true);
+    Guard->SetActorTickEnabled(true);
+    SetComponentsTickEnabled(Guard, true);
+
+    // Reset character state: health, stats, inventory and death side effects
+    if (AACFCharacter* Character = Cast<AACFCharacter>(Guard)) {
+        if (UACFRagdollComponent* RagdollComp = Character->FindComponentByClass<UACFRagdollComponent>()) {
+            if (RagdollComp->IsInRagDoll()) {
+                RagdollComp->RecoverFromRagdoll();
+            }
+        }
+
+        if (Character->GetIsDead()) {
+            Character->ReviveCharacter(1.0f);
+        }
+
+        if (UCapsuleComponent* Capsule = Character->GetCapsuleComponent()) {
+            const ACharacter* DefaultCharacter = Character->GetClass()->GetDefaultObject<ACharacter>();
+            Capsule->SetCollisionResponseToChannels(DefaultCharacter->GetCapsuleComponent()->GetCollisionResponseToChannels());
+        }
+
+        if (UARSStatisticsComponent* StatsComp = Character->GetStatisticsComponent()) {
+            StatsComp->InitializeAttributeSet();
+        }
+
+        // Destroy the equipped weapons and armors of the previous life before granting the starting items again
+        if (UACFEquipmentComponent* EquipmentComp = Character->GetEquipmentComponent()) {
+            EquipmentComp->ResetEquipment();
+            EquipmentComp->InitializeStartingItems();
+        }
+    }
+
+    if (!Guard->GetController()) {
+        Guard->SpawnDefaultController();
+    }
+
+    // Reset controller state: threats, perception, AI state and behavior tree
+    if (AACFAIController* ACFController = Cast<AACFAIController>(Guard->GetController())) {
+        ACFController->SetActorTickEnabled(true);
+        SetComponentsTickEnabled(ACFController, true);
+
+        if (UACFThreatManagerComponent* ThreatManager = ACFController->GetThreatManager()) {
+            ThreatManager->RemoveAllThreatenings();
+        }
+
+        if (UAIPerceptionComponent* Perception = ACFController->GetAIPerceptionComponent()) {
+            Perception->ForgetAll();
+            Perception->SetActive(true);
+        }
+
+        ACFController->ResetToDefaultState();
+
+        if (UBrainComponent* Brain = ACFController->GetBrainComponent()) {
+            Brain->RestartLogic();
+        }
+    }
+
+    SetGuardRegistered(Guard, true);
+}
+
+void UPortalDefenseSpawner::DeactivateGuard(APawn* Guard)
+{
+    SetGuardRegistered(Guard, false);
+
+    if (AACFAIController* ACFController = Cast<AACFAIController>(Guard->GetController())) {
+        if (UBrainComponent* Brain = ACFController->GetBrainComponent()) {
+            Brain->StopLogic(TEXT("Pooled"));
+        }
+
+        if (UAIPerceptionComponent* Perception = ACFController->GetAIPerceptionComponent()) {
+            Perception->SetActive(false);
+        }
+
+        ACFController->StopMovement();
+        ACFController->SetActorTickEnabled(false);
+        SetComponentsTickEnabled(ACFController, false);
+
+        if (AIOverlord) {
+            AIOverlord->UnregisterAI(ACFController);
+        }
+    }
+
+    Guard->SetActorHiddenInGame(true);
+    Guard->SetActorEnableCollision(false);
+    Guard->SetActorTickEnabled(false);
+    SetComponentsTickEnabled(Guard, false);
+}
+
+void UPortalDefenseSpawner::SetGuardRegistered(APawn* Guard, bool bRegistered)
+{
+    // Pooled guards must not be updated by the AI managers, the overlord is handled by SetupGuardBehavior/DeactivateGuard
+    if (AACFAIController* ACFController = Cast<AACFAIController>(Guard->GetController())) {
+        if (UAILODManager* LODManager = UAILODManager::GetInstance(GetWorld())) {
+            if (bRegistered) {
+                LODManager->RegisterAI(ACFController);
+            } else {
+                LODManager->UnregisterAI(ACFController);
+            }
+        }
+
+        // Batches are rebuilt from the LOD manager, so only a removal is needed
+        if (!bRegistered) {
+            if (UAIBatchProcessor* BatchProcessor = UAIBatchProcessor::GetInstance(GetWorld())) {
+                BatchProcessor->RemoveAIFromAllBatches(ACFController);
+            }
+        }
+    }
+
+    if (UPortalStealthContextSubsystem* StealthContext = UPortalStealthContextSubsystem::GetInstance(this)) {
+        UACFStealthDetectionComponent* StealthComp = Guard->FindComponentByClass<UACFStealthDetectionComponent>();
+        if (!StealthComp && Guard->GetController()) {
+            StealthComp = Guard->GetController()->FindComponentByClass<UACFStealthDetectionComponent>();
+        }
+
+        if (bRegistered) {
+            StealthContext->RegisterGuard(StealthComp);
+        } else {
+            StealthContext->UnregisterGuard(StealthComp);
+        }
+    }
+}
+
+void UPortalDefenseSpawner::SetComponentsTickEnabled(AActor* Actor, bool bEnabled)
+{
+    // Components that start with tick disabled enable it themselves when needed
+    for (UActorComponent* Component : Actor->GetComponents()) {
+        if (Component && (!bEnabled || Component->PrimaryComponentTick.bStartWithTickEnabled)) {
+            Component->SetComponentTickEnabled(bEnabled);
+        }
+    }
+}
+
+void UPortalDefenseSpawner::DestroyGuardPools()
+{
+    PendingPrewarmRings.Reset();
+
+    for (FDefenseRingCache& RingCache : RingCaches) {
+        TArray<TObjectPtr<APawn>> PooledGuards = MoveTemp(RingCache.PooledGuards);
+        RingCache.PooledGuards.Reset();
+
+        for (APawn* Guard : PooledGuards) {
+            if (Guard && IsValid(Guard)) {
+                Guard->Destroy();
+            }
+        }
+    }
+
+    RingCaches.Empty();
+}
@@ -6,6 +6,7 @@
 #include "Engine/TimerHandle.h"
 #include "PortalDefenseSpawner.generated.h"
 
+class AACFCharacter;
 class APortalCore;
 class UAIOverlordManager;
 
@@ -86,6 +87,18 @@ struct FActiveGuardInfo {
     }
 };
 
+// Per ring cache: pooled guards ready for reuse and traced ground location of every slot
+USTRUCT()
+struct FDefenseRingCache {
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<APawn>> PooledGuards;
+
+    UPROPERTY()
+    TArray<FVector> SlotLocations;
+};
+
 UCLASS(ClassGroup = (Portal), meta = (BlueprintSpawnableComponent))
 class PORTAL_API UPortalDefenseSpawner : public UActorComponent {
     GENERATED_BODY()
@@ -121,6 +134,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Portal Defense")
     void ScheduleGuardRespawn(const FActiveGuardInfo& GuardInfo);
 
+    // Guard Pool
+    UFUNCTION(BlueprintCallable, Category = "Portal Defense")
+    void PrewarmGuardPools();
+
+    UFUNCTION(BlueprintCallable, Category = "Portal Defense")
+    void ReleaseGuardToPool(APawn* Guard);
+
+    UFUNCTION(BlueprintPure, Category = "Portal Defense")
+    int32 GetPooledGuardCount() const;
+
     // Position Calculation
     UFUNCTION(BlueprintPure, Category = "Portal Defense")
     FVector GetRingPosition(float Distance, int32 PositionIndex, int32 TotalPositions) const;
@@ -163,6 +186,22 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
     bool bReplaceDeadGuards = true;
 
+    // Pooling Settings
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+    bool bUseGuardPool = true;
+
+    // Extra guards pre-warmed per ring on top of GuardsPerRing, to absorb respawns
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (EditCondition = "bUseGuardPool"))
+    int32 ExtraPooledGuardsPerRing = 1;
+
+    // Pre-warm spawns are spread across frames to avoid a load hitch
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (EditCondition = "bUseGuardPool"))
+    int32 PrewarmSpawnsPerFrame = 4;
+
+    // Time a dead guard stays in the world (death animation, loot) before returning to the pool
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (EditCondition = "bUseGuardPool"))
+    float DeadGuardReturnDelay = 5.0f;
+
     // Portal Reference
     UPROPERTY(BlueprintReadOnly, Category = "Portal Defense")
     TObjectPtr<APortalCore> PortalCore;
@@ -184,12 +223,31 @@ private:
     UPROPERTY()
     TObjectPtr<UAIOverlordManager> AIOverlord;
 
+    // Guard Pool, indexed like DefenseRings
+    UPROPERTY()
+    TArray<FDefenseRingCache> RingCaches;
+
+    // Rings still waiting for pre-warm spawns
+    TArray<int32> PendingPrewarmRings;
+    FTimerHandle PrewarmTimer;
+
     // Internal Functions
     void InitializePortalReference();
     void RegisterWithOverlord();
     void CheckForMissingGuards();
     bool IsPositionValid(FVector Position) const;
     FVector GetPatrolCenter(const FDefenseRingConfig& RingConfig, FVector SpawnLocation) const;
+    FVector GetSlotLocation(const FDefenseRingConfig& RingConfig, int32 RingIndex, int32 PositionIndex);
+    void ProcessPrewarmQueue();
+    APawn* AcquireGuard(const FDefenseRingConfig& RingConfig, int32 RingIndex, const FVector& SpawnLocation);
+    APawn* SpawnPooledGuard(const FDefenseRingConfig& RingConfig, const FVector& SpawnLocation);
+    void ActivateGuard(APawn* Guard, const FVector& SpawnLocation);
+    void DeactivateGuard(APawn* Guard);
+    void SetGuardRegistered(APawn* Guard, bool bRegistered);
+    static void SetComponentsTickEnabled(AActor* Actor, bool bEnabled);
+    void ReturnGuardToRing(TWeakObjectPtr<APawn> Guard, int32 RingIndex);
+    int32 HandleGuardLost(APawn* Guard);
+    void DestroyGuardPools();
 
     UFUNCTION()
     void OnSpawnCheckTimer();
@@ -197,6 +255,9 @@ private:
     UFUNCTION()
     void OnGuardDestroyed(AActor* DestroyedActor);
 
+    UFUNCTION()
+    void OnGuardDeath(AACFCharacter* DeadCharacter);
+
     UFUNCTION()
     void OnRespawnTimerComplete(FGuid RespawnID, FActiveGuardInfo GuardInfo);
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "PortalInteractionComponent.h"
+#include "Components/SphereComponent.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
@@ -8,7 +9,7 @@
 
 UPortalInteractionComponent::UPortalInteractionComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bCanEverTick = false;
     bWasInCaptureZone = false;
     bHasShownCaptureZoneIndicator = false;
 }
@@ -22,17 +23,37 @@ void UPortalInteractionComponent::BeginPlay()
         GameState->OnPortalHealthChanged.AddDynamic(this, &UPortalInteractionComponent::OnPortalHealthChanged);
         GameState->OnCaptureProgressChanged.AddDynamic(this, &UPortalInteractionComponent::OnCaptureProgressChanged);
         GameState->OnPatrolGuardCountChanged.AddDynamic(this, &UPortalInteractionComponent::OnPatrolGuardCountChanged);
+        GameState->OnCaptureStatusChanged.AddDynamic(this, &UPortalInteractionComponent::OnCaptureStatusChanged);
+    }
+
+    // Zone entry and exit come from the portal capture volume instead of a per-frame distance check
+    PortalCore = Cast<APortalCore>(UGameplayStatics::GetActorOfClass(GetWorld(), APortalCore::StaticClass()));
+    if (USphereComponent* CaptureZone = PortalCore ? PortalCore->GetCaptureZone() : nullptr) {
+        CaptureZone->OnComponentBeginOverlap.AddDynamic(this, &UPortalInteractionComponent::OnCaptureZoneBeginOverlap);
+        CaptureZone->OnComponentEndOverlap.AddDynamic(this, &UPortalInteractionComponent::OnCaptureZoneEndOverlap);
+        bWasInCaptureZone = CaptureZone->IsOverlappingActor(GetOwner());
+    }
+
+    // The proximity indicator is cosmetic only
+    if (GetNetMode() != NM_DedicatedServer) {
+        GetWorld()->GetTimerManager().SetTimer(IndicatorCheckTimer, this, &UPortalInteractionComponent::CheckCaptureZoneStatus, IndicatorCheckInterval, true);
     }
 
     UpdateUI();
 }
 
-void UPortalInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UPortalInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    if (UWorld* World = GetWorld()) {
+        World->GetTimerManager().ClearTimer(IndicatorCheckTimer);
+    }
 
-    UpdateUI();
-    CheckCaptureZoneStatus();
+    if (USphereComponent* CaptureZone = PortalCore ? PortalCore->GetCaptureZone() : nullptr) {
+        CaptureZone->OnComponentBeginOverlap.RemoveDynamic(this, &UPortalInteractionComponent::OnCaptureZoneBeginOverlap);
+        CaptureZone->OnComponentEndOverlap.RemoveDynamic(this, &UPortalInteractionComponent::OnCaptureZoneEndOverlap);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UPortalInteractionComponent::EnterCaptureZone()
@@ -73,19 +94,14 @@ APortalDefenseGameState* UPortalInteractionComponent::GetPortalGameState() const
 
 bool UPortalInteractionComponent::IsInCaptureZone() const
 {
-    if (APortalDefenseGameMode* GameMode = GetWorld()->GetAuthGameMode<APortalDefenseGameMode>()) {
-        if (APawn* OwnerPawn = Cast<APawn>(GetOwner())) {
-            return GameMode->IsPlayerInCaptureZone(OwnerPawn);
-        }
-    }
-    return false;
+    return bWasInCaptureZone;
 }
 
 float UPortalInteractionComponent::GetDistanceToPortal() const
 {
-    if (APortalCore* Portal = Cast<APortalCore>(UGameplayStatics::GetActorOfClass(GetWorld(), APortalCore::StaticClass()))) {
+    if (PortalCore) {
         if (AActor* Owner = GetOwner()) {
-            return FVector::Dist(Owner->GetActorLocation(), Portal->GetActorLocation());
+            return FVector::Dist(Owner->GetActorLocation(), PortalCore->GetActorLocation());
         }
     }
     return -1.0f;
@@ -93,11 +109,7 @@ float UPortalInteractionComponent::GetDistanceToPortal() const
 
 float UPortalInteractionComponent::GetCaptureZoneRadius() const
 {
-    if (APortalDefenseGameMode* GameMode = GetWorld()->GetAuthGameMode<APortalDefenseGameMode>()) {
-        // Access capture zone radius - would need to expose this in GameMode
-        return 500.0f; // Default value, should match GameMode setting
-    }
-    return 500.0f;
+    return PortalCore ? PortalCore->GetCaptureZoneRadius() : 500.0f;
 }
 
 void UPortalInteractionComponent::UpdateUI()
@@ -113,17 +125,6 @@ void UPortalInteractionComponent::UpdateUI()
 
 void UPortalInteractionComponent::CheckCaptureZoneStatus()
 {
-    bool bCurrentlyInZone = IsInCaptureZone();
-
-    if (bCurrentlyInZone != bWasInCaptureZone) {
-        if (bCurrentlyInZone) {
-            EnterCaptureZone();
-        } else {
-            ExitCaptureZone();
-        }
-        bWasInCaptureZone = bCurrentlyInZone;
-    }
-
     // Show capture zone indicator when getting close
     float DistanceToPortal = GetDistanceToPortal();
     float CaptureRadius = GetCaptureZoneRadius();
@@ -165,4 +166,25 @@ void UPortalInteractionComponent::OnPortalHealthChanged(float CurrentHealth, flo
 void UPortalInteractionComponent::OnPatrolGuardCountChanged(int32 GuardCount)
 {
     UpdateGuardCountDisplay(GuardCount);
+}
+
+void UPortalInteractionComponent::OnCaptureStatusChanged(bool bIsCapturing, int32 PlayersInZone)
+{
+    UpdateCaptureStatusDisplay(bIsCapturing, PlayersInZone);
+}
+
+void UPortalInteractionComponent::OnCaptureZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+    if (OtherActor == GetOwner() && !bWasInCaptureZone) {
+        bWasInCaptureZone = true;
+        EnterCaptureZone();
+    }
+}
+
+void UPortalInteractionComponent::OnCaptureZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+    if (OtherActor == GetOwner() && bWasInCaptureZone && !OverlappedComponent->IsOverlappingActor(OtherActor)) {
+        bWasInCaptureZone = false;
+        ExitCaptureZone();
+    }
 }
\ No newline at end of file
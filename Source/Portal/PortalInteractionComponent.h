@@ -2,9 +2,12 @@
 
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
 #include "PortalInteractionComponent.generated.h"
 
+class APortalCore;
 class APortalDefenseGameState;
+class UPrimitiveComponent;
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class PORTAL_API UPortalInteractionComponent : public UActorComponent {
@@ -15,7 +18,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // Capture Control
@@ -82,7 +85,26 @@ private:
     UFUNCTION()
     void OnPatrolGuardCountChanged(int32 GuardCount);
 
+    UFUNCTION()
+    void OnCaptureStatusChanged(bool bIsCapturing, int32 PlayersInZone);
+
+    // Capture Zone Event Bindings
+    UFUNCTION()
+    void OnCaptureZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+    UFUNCTION()
+    void OnCaptureZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
     // Internal State
+    UPROPERTY()
+    TObjectPtr<APortalCore> PortalCore;
+
+    // Seconds between capture zone indicator proximity checks
+    UPROPERTY(EditAnywhere, Category = "Capture")
+    float IndicatorCheckInterval = 0.5f;
+
+    FTimerHandle IndicatorCheckTimer;
+
     UPROPERTY()
     bool bWasInCaptureZone;
 
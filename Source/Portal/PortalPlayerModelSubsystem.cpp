@@ -0,0 +1,257 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "PortalPlayerModelSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+float FPortalPlayerModel::GetPatternConfidence() const
+{
+    if (RecentPositions.Num() < 5) {
+        return 0.0f;
+    }
+
+    float Confidence = 0.0f;
+
+    // Factor in position consistency
+    if (bPrefersCircleStrafing || bUsesEnvironmentCover) {
+        Confidence += 0.3f;
+    }
+
+    // Factor in attack pattern consistency
+    if (AttackCount >= 3) {
+        Confidence += 0.3f;
+    }
+
+    // Factor in dodge pattern consistency
+    if (DodgeCount >= 3) {
+        Confidence += 0.4f;
+    }
+
+    return FMath::Clamp(Confidence, 0.0f, 1.0f);
+}
+
+int32 FPortalPlayerModel::GetDominantDodgeBin() const
+{
+    int32 BestBin = INDEX_NONE;
+    int32 BestCount = 0;
+    for (int32 Bin = 0; Bin < DodgeBins; ++Bin) {
+        if (DodgeHistogram[Bin] > BestCount) {
+            BestCount = DodgeHistogram[Bin];
+            BestBin = Bin;
+        }
+    }
+    return BestBin;
+}
+
+void UPortalPlayerModelSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    InWorld.GetTimerManager().SetTimer(SampleTimer, this, &UPortalPlayerModelSubsystem::SamplePlayers, SampleInterval, true);
+}
+
+void UPortalPlayerModelSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld()) {
+        World->GetTimerManager().ClearTimer(SampleTimer);
+    }
+
+    PlayerModels.Empty();
+
+    Super::Deinitialize();
+}
+
+UPortalPlayerModelSubsystem* UPortalPlayerModelSubsystem::GetInstance(const UObject* WorldContext)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull)) {
+        return World->GetSubsystem<UPortalPlayerModelSubsystem>();
+    }
+    return nullptr;
+}
+
+void UPortalPlayerModelSubsystem::RecordPlayerPosition(APawn* Player, const FVector& Position)
+{
+    const UWorld* World = GetWorld();
+    if (!Player || !World) {
+        return;
+    }
+
+    FPortalPlayerModel& Model = FindOrAddModel(Player);
+    const float CurrentTime = World->GetTimeSeconds();
+
+    // Already sampled this frame
+    if (Model.LastSampleTime == CurrentTime) {
+        return;
+    }
+
+    SamplePlayer(Model, Position, CurrentTime);
+}
+
+void UPortalPlayerModelSubsystem::RecordPlayerAttack(APawn* Player, const FVector& AttackPosition, float Timing)
+{
+    if (!Player) {
+        return;
+    }
+
+    FPortalPlayerModel& Model = FindOrAddModel(Player);
+
+    if (Model.AttackTimings.Num() > 0) {
+        // Same attack reported by another guard, or reported out of order
+        if (Timing <= Model.AttackTimings.Last() + KINDA_SMALL_NUMBER) {
+            return;
+        }
+
+        const float Interval = Timing - Model.AttackTimings.Last();
+        Model.AttackIntervalEMA = Model.AttackIntervalEMA > 0.0f ? FMath::Lerp(Model.AttackIntervalEMA, Interval, SmoothingFactor) : Interval;
+    }
+
+    Model.AttackPositions.Add(AttackPosition);
+    Model.AttackTimings.Add(Timing);
+    Model.AttackCount++;
+
+    // Exponentially weighted mean and variance, first sample seeds the mean
+    if (Model.AttackCount == 1) {
+        Model.AttackPositionMean = AttackPosition;
+        Model.AttackPositionVariance = 0.0f;
+    } else {
+        const FVector Diff = AttackPosition - Model.AttackPositionMean;
+        Model.AttackPositionMean += SmoothingFactor * Diff;
+        Model.AttackPositionVariance = (1.0f - SmoothingFactor) * (Model.AttackPositionVariance + SmoothingFactor * Diff.SizeSquared());
+    }
+
+    // Low variance indicates consistent cover usage
+    Model.bUsesEnvironmentCover = Model.AttackCount >= 3 && Model.AttackPositionVariance < 250000.0f;
+}
+
+void UPortalPlayerModelSubsystem::RecordPlayerDodge(APawn* Player, const FVector& DodgeDirection)
+{
+    const UWorld* World = GetWorld();
+    if (!Player || !World) {
+        return;
+    }
+
+    FPortalPlayerModel& Model = FindOrAddModel(Player);
+    const float CurrentTime = World->GetTimeSeconds();
+
+    // Same dodge reported by another guard
+    if (Model.DodgeDirections.Num() > 0 && Model.LastDodgeTime == CurrentTime && Model.DodgeDirections.Last().Equals(DodgeDirection)) {
+        return;
+    }
+    Model.LastDodgeTime = CurrentTime;
+
+    // Running mean of consecutive dodge agreement
+    if (Model.DodgeDirections.Num() > 0) {
+        const float Dot = FVector::DotProduct(Model.DodgeDirections.Last(), DodgeDirection);
+        Model.DodgeConsistency += (Dot - Model.DodgeConsistency) / static_cast<float>(Model.DodgeCount);
+    }
+
+    Model.DodgeDirections.Add(DodgeDirection);
+    Model.DodgeCount++;
+    Model.DodgeDirectionMean += (DodgeDirection - Model.DodgeDirectionMean) / static_cast<float>(Model.DodgeCount);
+
+    const float Angle = FMath::Atan2(DodgeDirection.Y, DodgeDirection.X) + UE_PI;
+    const int32 Bin = FMath::Clamp(FMath::FloorToInt(Angle / (UE_TWO_PI / FPortalPlayerModel::DodgeBins)), 0, FPortalPlayerModel::DodgeBins - 1);
+    Model.DodgeHistogram[Bin]++;
+}
+
+const FPortalPlayerModel* UPortalPlayerModelSubsystem::GetPlayerModel(const APawn* Player) const
+{
+    return Player ? PlayerModels.Find(Player) : nullptr;
+}
+
+FPlayerBehaviorPattern UPortalPlayerModelSubsystem::BuildBehaviorPattern(APawn* Player) const
+{
+    FPlayerBehaviorPattern Pattern;
+
+    const FPortalPlayerModel* Model = GetPlayerModel(Player);
+    if (!Model) {
+        return Pattern;
+    }
+
+    Model->RecentPositions.ForEach([&Pattern](const FVector& Position) { Pattern.RecentPositions.Add(Position); });
+    Model->AttackPositions.ForEach([&Pattern](const FVector& Position) { Pattern.AttackPositions.Add(Position); });
+    Model->AttackTimings.ForEach([&Pattern](float Timing) { Pattern.AttackTimings.Add(Timing); });
+    Model->DodgeDirections.ForEach([&Pattern](const FVector& Direction) { Pattern.DodgeDirections.Add(Direction); });
+
+    // PreferredEngagementDistance is relative to each guard, UEliteAIIntelligenceComponent fills it
+    Pattern.AverageMovementSpeed = Model->AverageMovementSpeed;
+    Pattern.PreferredDodgeDirection = Model->DodgeDirectionMean;
+    Pattern.AttackFrequency = Model->GetAttackFrequency();
+    Pattern.bPrefersCircleStrafing = Model->bPrefersCircleStrafing;
+    Pattern.bUsesEnvironmentCover = Model->bUsesEnvironmentCover;
+    Pattern.PatternConfidence = Model->GetPatternConfidence();
+
+    return Pattern;
+}
+
+FPortalPlayerModel& UPortalPlayerModelSubsystem::FindOrAddModel(APawn* Player)
+{
+    return PlayerModels.FindOrAdd(Player);
+}
+
+void UPortalPlayerModelSubsystem::SamplePlayers()
+{
+    UWorld* World = GetWorld();
+    if (!World) {
+        return;
+    }
+
+    const float CurrentTime = World->GetTimeSeconds();
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+        const APlayerController* PlayerController = It->Get();
+        if (APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr) {
+            SamplePlayer(FindOrAddModel(PlayerPawn), PlayerPawn->GetActorLocation(), CurrentTime);
+        }
+    }
+
+    // Drop models of pawns that no longer exist
+    for (auto It = PlayerModels.CreateIterator(); It; ++It) {
+        if (!It->Key.IsValid()) {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UPortalPlayerModelSubsystem::SamplePlayer(FPortalPlayerModel& Model, const FVector& Position, float CurrentTime)
+{
+    if (Model.RecentPositions.Num() > 0 && Model.LastSampleTime >= 0.0f) {
+        const float DeltaTime = FMath::Max(CurrentTime - Model.LastSampleTime, KINDA_SMALL_NUMBER);
+        Model.SampleVelocity = (Position - Model.RecentPositions.Last()) / DeltaTime;
+        Model.AverageMovementSpeed = FMath::Lerp(Model.AverageMovementSpeed, static_cast<float>(Model.SampleVelocity.Size()), SmoothingFactor);
+    }
+
+    Model.RecentPositions.Add(Position);
+    Model.LastSampleTime = CurrentTime;
+
+    AnalyzeMovement(Model);
+}
+
+void UPortalPlayerModelSubsystem::AnalyzeMovement(FPortalPlayerModel& Model)
+{
+    const int32 NumPositions = Model.RecentPositions.Num();
+    if (NumPositions < 5) {
+        return;
+    }
+
+    // Bounded by PositionCapacity, so this stays O(1) per player
+    FVector CenterPoint = FVector::ZeroVector;
+    Model.RecentPositions.ForEach([&CenterPoint](const FVector& Pos) { CenterPoint += Pos; });
+    CenterPoint /= NumPositions;
+
+    float DistanceSum = 0.0f;
+    float DistanceSquaredSum = 0.0f;
+    Model.RecentPositions.ForEach([&](const FVector& Pos) {
+        const float Distance = FVector::Dist(Pos, CenterPoint);
+        DistanceSum += Distance;
+        DistanceSquaredSum += Distance * Distance;
+    });
+
+    const float AvgDistance = DistanceSum / NumPositions;
+    const float DistanceVariance = DistanceSquaredSum / NumPositions - AvgDistance * AvgDistance;
+
+    // Low variance in distance from center indicates circular movement
+    Model.bPrefersCircleStrafing = (DistanceVariance < 10000.0f && AvgDistance > 300.0f);
+}
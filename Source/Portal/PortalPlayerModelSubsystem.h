@@ -0,0 +1,141 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EliteAIIntelligenceComponent.h"
+#include "Engine/TimerHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PortalPlayerModelSubsystem.generated.h"
+
+class APawn;
+
+// Fixed-capacity ring buffer, the oldest entry is overwritten once full
+template <typename ElementType, int32 Capacity>
+struct TPortalRingBuffer {
+    ElementType Items[Capacity];
+    int32 Head = 0;
+    int32 Count = 0;
+
+    void Add(const ElementType& Item)
+    {
+        Items[Head] = Item;
+        Head = (Head + 1) % Capacity;
+        Count = FMath::Min(Count + 1, Capacity);
+    }
+
+    // Back = 0 is the newest entry
+    const ElementType& Last(int32 Back = 0) const
+    {
+        check(Back < Count);
+        return Items[(Head - 1 - Back + Capacity) % Capacity];
+    }
+
+    int32 Num() const { return Count; }
+    void Reset() { Head = 0; Count = 0; }
+
+    template <typename FuncType>
+    void ForEach(FuncType&& Func) const
+    {
+        for (int32 Back = Count - 1; Back >= 0; --Back) {
+            Func(Last(Back));
+        }
+    }
+};
+
+/**
+ * Behaviour model of one player, shared by every guard.
+ * History is bounded by ring buffers and all statistics are updated incrementally per sample/event.
+ */
+struct FPortalPlayerModel {
+    static constexpr int32 PositionCapacity = 16;
+    static constexpr int32 EventCapacity = 8;
+    static constexpr int32 DodgeBins = 8;
+
+    TPortalRingBuffer<FVector, PositionCapacity> RecentPositions;
+    TPortalRingBuffer<FVector, EventCapacity> AttackPositions;
+    TPortalRingBuffer<float, EventCapacity> AttackTimings;
+    TPortalRingBuffer<FVector, EventCapacity> DodgeDirections;
+
+    // Movement
+    FVector SampleVelocity = FVector::ZeroVector;
+    float AverageMovementSpeed = 0.0f;
+    float LastSampleTime = -1.0f;
+    bool bPrefersCircleStrafing = false;
+
+    // Attacks: exponentially weighted mean/variance of position, EMA of the interval between attacks
+    int32 AttackCount = 0;
+    FVector AttackPositionMean = FVector::ZeroVector;
+    float AttackPositionVariance = 0.0f;
+    float AttackIntervalEMA = 0.0f;
+    bool bUsesEnvironmentCover = false;
+
+    // Dodges: direction histogram (2D, DodgeBins sectors), running mean direction and consecutive consistency
+    int32 DodgeCount = 0;
+    int32 DodgeHistogram[DodgeBins] = { 0 };
+    FVector DodgeDirectionMean = FVector::ZeroVector;
+    float DodgeConsistency = 0.0f;
+    float LastDodgeTime = -1.0f;
+
+    float GetAttackFrequency() const { return AttackIntervalEMA > 0.0f ? 1.0f / FMath::Max(AttackIntervalEMA, 0.1f) : 0.0f; }
+    float GetPatternConfidence() const;
+    int32 GetDominantDodgeBin() const;
+};
+
+/**
+ * World-level player modeling service. Samples every player once per interval and keeps one
+ * FPortalPlayerModel per player, so guards read a shared model instead of each tracking the player.
+ */
+UCLASS(BlueprintType)
+class PORTAL_API UPortalPlayerModelSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // Subsystem Access
+    UFUNCTION(BlueprintCallable, Category = "Player Model")
+    static UPortalPlayerModelSubsystem* GetInstance(const UObject* WorldContext);
+
+    // Event Recording. Every guard observing an event may report it, repeated reports are ignored
+    UFUNCTION(BlueprintCallable, Category = "Player Model")
+    void RecordPlayerPosition(APawn* Player, const FVector& Position);
+
+    UFUNCTION(BlueprintCallable, Category = "Player Model")
+    void RecordPlayerAttack(APawn* Player, const FVector& AttackPosition, float Timing);
+
+    UFUNCTION(BlueprintCallable, Category = "Player Model")
+    void RecordPlayerDodge(APawn* Player, const FVector& DodgeDirection);
+
+    // Queries
+    const FPortalPlayerModel* GetPlayerModel(const APawn* Player) const;
+
+    UFUNCTION(BlueprintPure, Category = "Player Model")
+    FPlayerBehaviorPattern BuildBehaviorPattern(APawn* Player) const;
+
+    UFUNCTION(BlueprintPure, Category = "Player Model")
+    int32 GetModeledPlayerCount() const { return PlayerModels.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Player Model")
+    float GetSampleInterval() const { return SampleInterval; }
+
+    UFUNCTION(BlueprintPure, Category = "Player Model")
+    float GetSmoothingFactor() const { return SmoothingFactor; }
+
+private:
+    static constexpr float SampleInterval = 0.1f;
+
+    // Weight of the newest value in the exponential averages
+    static constexpr float SmoothingFactor = 0.25f;
+
+    TMap<TWeakObjectPtr<const APawn>, FPortalPlayerModel> PlayerModels;
+
+    FTimerHandle SampleTimer;
+
+    FPortalPlayerModel& FindOrAddModel(APawn* Player);
+    void SamplePlayers();
+    void SamplePlayer(FPortalPlayerModel& Model, const FVector& Position, float CurrentTime);
+    static void AnalyzeMovement(FPortalPlayerModel& Model);
+};
@@ -0,0 +1,455 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "PortalStealthContextSubsystem.h"
+#include "ACFStealthDetectionComponent.h"
+#include "Components/LightComponent.h"
+#include "Components/LocalLightComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+void UPortalStealthContextSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (UWorld* World = GetWorld()) {
+        ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+            FOnActorSpawned::FDelegate::CreateUObject(this, &UPortalStealthContextSubsystem::HandleActorSpawned));
+        ActorDestroyedHandle = World->AddOnActorDestroyedHandler(
+            FOnActorDestroyed::FDelegate::CreateUObject(this, &UPortalStealthContextSubsystem::HandleActorDestroyed));
+        // Also fires for deferred spawns and re-registered actors, after their lights are registered
+        ActorComponentsRegisteredHandle = World->AddOnPostRegisterAllActorComponentsHandler(
+            FOnPostRegisterAllActorComponents::FDelegate::CreateUObject(this, &UPortalStealthContextSubsystem::HandleActorComponentsRegistered));
+    }
+
+    LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UPortalStealthContextSubsystem::HandleLevelAdded);
+    LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UPortalStealthContextSubsystem::HandleLevelRemoved);
+}
+
+void UPortalStealthContextSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld()) {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        World->RemoveOnActorDestroyedHandler(ActorDestroyedHandle);
+        World->RemoveOnPostRegisterAllActorComponentsHandler(ActorComponentsRegisteredHandle);
+        World->GetTimerManager().ClearTimer(LightPruneTimer);
+    }
+
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+    LightGrid.Empty();
+    CoverGrid.Empty();
+    LightCells.Empty();
+    CoverCells.Empty();
+    MovableLights.Empty();
+    MovableCover.Empty();
+    Guards.Empty();
+    GuardGrid.Empty();
+
+    Super::Deinitialize();
+}
+
+void UPortalStealthContextSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Seed the grid with everything placed in the loaded levels, spawns are tracked from here on
+    for (ULevel* Level : InWorld.GetLevels()) {
+        IndexLevel(Level);
+    }
+
+    InWorld.GetTimerManager().SetTimer(LightPruneTimer, this, &UPortalStealthContextSubsystem::PruneLights, LightPruneInterval, true);
+
+    UE_LOG(LogTemp, Log, TEXT("Stealth Context: Indexed %d lights and %d cover actors"),
+        GetRegisteredLightCount(), GetRegisteredCoverCount());
+}
+
+UPortalStealthContextSubsystem* UPortalStealthContextSubsystem::GetInstance(const UObject* WorldContext)
+{
+    if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull)) {
+        return World->GetSubsystem<UPortalStealthContextSubsystem>();
+    }
+    return nullptr;
+}
+
+void UPortalStealthContextSubsystem::RegisterActor(AActor* Actor)
+{
+    if (!Actor || !IsValid(Actor)) {
+        return;
+    }
+
+    TInlineComponentArray<ULightComponent*> LightComponents(Actor);
+    for (ULightComponent* LightComp : LightComponents) {
+        RegisterLight(LightComp);
+    }
+
+    if (Actor->Tags.Num() == 0 || CoverCells.Contains(Actor) || MovableCover.Contains(Actor)) {
+        return;
+    }
+
+    // Moving cover would go stale in the grid, it is checked at its current location instead
+    if (IsMovableActor(Actor)) {
+        MovableCover.Add(Actor);
+        return;
+    }
+
+    FStealthCoverEntry Entry;
+    Entry.Actor = Actor;
+    Entry.Location = Actor->GetActorLocation();
+    Entry.Tags = Actor->Tags;
+
+    const FIntPoint Cell = GetCell(Entry.Location);
+    CoverGrid.FindOrAdd(Cell).Add(MoveTemp(Entry));
+    CoverCells.Add(Actor, Cell);
+}
+
+void UPortalStealthContextSubsystem::UnregisterActor(AActor* Actor)
+{
+    if (!Actor) {
+        return;
+    }
+
+    TInlineComponentArray<ULightComponent*> LightComponents(Actor);
+    for (ULightComponent* LightComp : LightComponents) {
+        UnregisterLight(LightComp);
+    }
+
+    if (MovableCover.RemoveSwap(Actor) > 0) {
+        return;
+    }
+
+    FIntPoint Cell;
+    if (CoverCells.RemoveAndCopyValue(Actor, Cell)) {
+        if (TArray<FStealthCoverEntry>* Entries = CoverGrid.Find(Cell)) {
+            Entries->RemoveAllSwap([Actor](const FStealthCoverEntry& Entry) {
+                return !Entry.Actor.IsValid() || Entry.Actor.Get() == Actor;
+            });
+            if (Entries->Num() == 0) {
+                CoverGrid.Remove(Cell);
+            }
+        }
+    }
+}
+
+void UPortalStealthContextSubsystem::RegisterLight(ULightComponent* Light)
+{
+    if (!Light || LightCells.Contains(Light) || MovableLights.Contains(Light)) {
+        return;
+    }
+
+    if (Light->Mobility == EComponentMobility::Movable) {
+        MovableLights.Add(Light);
+        return;
+    }
+
+    FStealthLightEntry Entry;
+    Entry.Light = Light;
+    Entry.Location = Light->GetComponentLocation();
+    Entry.Radius = GetLightRadius(Light);
+
+    const FIntPoint Cell = GetCell(Entry.Location);
+    LightGrid.FindOrAdd(Cell).Add(Entry);
+    LightCells.Add(Light, Cell);
+}
+
+void UPortalStealthContextSubsystem::UnregisterLight(ULightComponent* Light)
+{
+    if (!Light) {
+        return;
+    }
+
+    if (MovableLights.RemoveSwap(Light) > 0) {
+        return;
+    }
+
+    FIntPoint Cell;
+    if (LightCells.RemoveAndCopyValue(Light, Cell)) {
+        if (TArray<FStealthLightEntry>* Entries = LightGrid.Find(Cell)) {
+            Entries->RemoveAllSwap([Light](const FStealthLightEntry& Entry) {
+                return !Entry.Light.IsValid() || Entry.Light.Get() == Light;
+            });
+            if (Entries->Num() == 0) {
+                LightGrid.Remove(Cell);
+            }
+        }
+    }
+}
+
+void UPortalStealthContextSubsystem::RegisterGuard(UACFStealthDetectionComponent* Guard)
+{
+    if (Guard && !Guards.Contains(Guard)) {
+        Guards.Add(Guard);
+        GuardGridFrame = MAX_uint64;
+    }
+}
+
+void UPortalStealthContextSubsystem::UnregisterGuard(UACFStealthDetectionComponent* Guard)
+{
+    if (Guard && Guards.RemoveSwap(Guard) > 0) {
+        GuardGridFrame = MAX_uint64;
+    }
+}
+
+template <typename Predicate>
+bool UPortalStealthContextSubsystem::ForEachLightNear(const FVector& Point, float MaxRadius, Predicate&& Pred) const
+{
+    auto VisitLight = [&](const ULightComponent* LightComp, const FVector& LightLocation, float LightRadius) {
+        if (!LightComp || !LightComp->IsRegistered() || !LightComp->IsVisible()) {
+            return false;
+        }
+
+        const float EffectiveRadius = LightRadius > 0.0f ? FMath::Min(LightRadius, MaxRadius) : MaxRadius;
+        const float DistSquared = FVector::DistSquared(Point, LightLocation);
+        if (DistSquared > FMath::Square(EffectiveRadius)) {
+            return false;
+        }
+
+        return Pred(FMath::Sqrt(DistSquared), EffectiveRadius);
+    };
+
+    // Effective radius never exceeds MaxRadius, so only the cells it covers can contain a hit
+    const FIntPoint MinCell = GetCell(Point - FVector(MaxRadius));
+    const FIntPoint MaxCell = GetCell(Point + FVector(MaxRadius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X) {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y) {
+            if (const TArray<FStealthLightEntry>* Entries = LightGrid.Find(FIntPoint(X, Y))) {
+                for (const FStealthLightEntry& Entry : *Entries) {
+                    if (VisitLight(Entry.Light.Get(), Entry.Location, Entry.Radius)) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    for (const TWeakObjectPtr<ULightComponent>& MovableLight : MovableLights) {
+        if (const ULightComponent* LightComp = MovableLight.Get()) {
+            if (VisitLight(LightComp, LightComp->GetComponentLocation(), GetLightRadius(LightComp))) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+float UPortalStealthContextSubsystem::GetLightIntensityAtPoint(const FVector& Point, float MaxRadius) const
+{
+    float Intensity = 0.0f;
+
+    ForEachLightNear(Point, MaxRadius, [&Intensity](float Distance, float EffectiveRadius) {
+        Intensity = FMath::Max(Intensity, EffectiveRadius > 0.0f ? 1.0f - (Distance / EffectiveRadius) : 1.0f);
+        return Intensity >= 1.0f;
+    });
+
+    return Intensity;
+}
+
+bool UPortalStealthContextSubsystem::IsPointIlluminated(const FVector& Point, float MaxRadius) const
+{
+    return ForEachLightNear(Point, MaxRadius, [](float, float) {
+        return true;
+    });
+}
+
+bool UPortalStealthContextSubsystem::IsPointInCover(const FVector& Point, const TArray<FName>& CoverTags, float Radius) const
+{
+    if (CoverTags.Num() == 0) {
+        return false;
+    }
+
+    const float RadiusSquared = FMath::Square(Radius);
+    const FIntPoint MinCell = GetCell(Point - FVector(Radius));
+    const FIntPoint MaxCell = GetCell(Point + FVector(Radius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X) {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y) {
+            const TArray<FStealthCoverEntry>* Entries = CoverGrid.Find(FIntPoint(X, Y));
+            if (!Entries) {
+                continue;
+            }
+
+            for (const FStealthCoverEntry& Entry : *Entries) {
+                if (FVector::DistSquared(Point, Entry.Location) >= RadiusSquared || !Entry.Actor.IsValid()) {
+                    continue;
+                }
+
+                for (const FName& Tag : CoverTags) {
+                    if (Entry.Tags.Contains(Tag)) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& CoverPtr : MovableCover) {
+        const AActor* CoverActor = CoverPtr.Get();
+        if (!CoverActor || FVector::DistSquared(Point, CoverActor->GetActorLocation()) >= RadiusSquared) {
+            continue;
+        }
+
+        for (const FName& Tag : CoverTags) {
+            if (CoverActor->Tags.Contains(Tag)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void UPortalStealthContextSubsystem::GetGuardsInRadius(const FVector& Point, float Radius, TArray<UACFStealthDetectionComponent*>& OutGuards) const
+{
+    RefreshGuardGrid();
+
+    const float RadiusSquared = FMath::Square(Radius);
+    const FIntPoint MinCell = GetCell(Point - FVector(Radius));
+    const FIntPoint MaxCell = GetCell(Point + FVector(Radius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X) {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y) {
+            const TArray<TWeakObjectPtr<UACFStealthDetectionComponent>>* Entries = GuardGrid.Find(FIntPoint(X, Y));
+            if (!Entries) {
+                continue;
+            }
+
+            for (const TWeakObjectPtr<UACFStealthDetectionComponent>& GuardPtr : *Entries) {
+                UACFStealthDetectionComponent* Guard = GuardPtr.Get();
+                const APawn* GuardPawn = Guard ? Guard->GetGuardPawn() : nullptr;
+                if (GuardPawn && FVector::DistSquared(Point, GuardPawn->GetActorLocation()) <= RadiusSquared) {
+                    OutGuards.Add(Guard);
+                }
+            }
+        }
+    }
+}
+
+void UPortalStealthContextSubsystem::GetPlayerPawns(TArray<APawn*>& OutPlayers) const
+{
+    if (UWorld* World = GetWorld()) {
+        for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It) {
+            if (APlayerController* PC = It->Get()) {
+                if (APawn* PlayerPawn = PC->GetPawn()) {
+                    OutPlayers.Add(PlayerPawn);
+                }
+            }
+        }
+    }
+}
+
+FIntPoint UPortalStealthContextSubsystem::GetCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+float UPortalStealthContextSubsystem::GetLightRadius(const ULightComponent* Light)
+{
+    if (const ULocalLightComponent* LocalLight = Cast<ULocalLightComponent>(Light)) {
+        return LocalLight->AttenuationRadius;
+    }
+    return 0.0f;
+}
+
+bool UPortalStealthContextSubsystem::IsMovableActor(const AActor* Actor)
+{
+    if (Actor->IsA<APawn>()) {
+        return true;
+    }
+    const USceneComponent* Root = Actor->GetRootComponent();
+    return Root && Root->Mobility == EComponentMobility::Movable;
+}
+
+void UPortalStealthContextSubsystem::IndexLevel(ULevel* Level)
+{
+    if (!Level) {
+        return;
+    }
+
+    for (AActor* Actor : Level->Actors) {
+        RegisterActor(Actor);
+    }
+}
+
+void UPortalStealthContextSubsystem::RefreshGuardGrid() const
+{
+    if (GuardGridFrame == GFrameCounter) {
+        return;
+    }
+
+    GuardGridFrame = GFrameCounter;
+    for (auto& CellPair : GuardGrid) {
+        CellPair.Value.Reset();
+    }
+
+    for (const TWeakObjectPtr<UACFStealthDetectionComponent>& GuardPtr : Guards) {
+        const UACFStealthDetectionComponent* Guard = GuardPtr.Get();
+        if (const APawn* GuardPawn = Guard ? Guard->GetGuardPawn() : nullptr) {
+            GuardGrid.FindOrAdd(GetCell(GuardPawn->GetActorLocation())).Add(GuardPtr);
+        }
+    }
+}
+
+void UPortalStealthContextSubsystem::PruneLights()
+{
+    // Drop lights that were unregistered or destroyed without their actor
+    for (auto It = LightCells.CreateIterator(); It; ++It) {
+        const ULightComponent* LightComp = It->Key.Get();
+        if (LightComp && LightComp->IsRegistered()) {
+            continue;
+        }
+
+        if (TArray<FStealthLightEntry>* Entries = LightGrid.Find(It->Value)) {
+            Entries->RemoveAllSwap([LightComp](const FStealthLightEntry& Entry) {
+                return !Entry.Light.IsValid() || Entry.Light.Get() == LightComp;
+            });
+            if (Entries->Num() == 0) {
+                LightGrid.Remove(It->Value);
+            }
+        }
+        It.RemoveCurrent();
+    }
+    MovableLights.RemoveAllSwap([](const TWeakObjectPtr<ULightComponent>& Light) {
+        return !Light.IsValid() || !Light->IsRegistered();
+    });
+}
+
+void UPortalStealthContextSubsystem::HandleActorSpawned(AActor* Actor)
+{
+    RegisterActor(Actor);
+}
+
+void UPortalStealthContextSubsystem::HandleActorComponentsRegistered(AActor* Actor)
+{
+    RegisterActor(Actor);
+}
+
+void UPortalStealthContextSubsystem::HandleActorDestroyed(AActor* Actor)
+{
+    UnregisterActor(Actor);
+}
+
+void UPortalStealthContextSubsystem::HandleLevelAdded(ULevel* Level, UWorld* World)
+{
+    if (World == GetWorld()) {
+        IndexLevel(Level);
+    }
+}
+
+void UPortalStealthContextSubsystem::HandleLevelRemoved(ULevel* Level, UWorld* World)
+{
+    if (World != GetWorld()) {
+        return;
+    }
+
+    if (Level) {
+        for (AActor* Actor : Level->Actors) {
+            UnregisterActor(Actor);
+        }
+    }
+}
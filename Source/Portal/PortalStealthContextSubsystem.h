@@ -0,0 +1,147 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PortalStealthContextSubsystem.generated.h"
+
+class AActor;
+class APawn;
+class ULevel;
+class ULightComponent;
+class UACFStealthDetectionComponent;
+
+// Light source cached in the stealth grid
+struct FStealthLightEntry {
+    TWeakObjectPtr<ULightComponent> Light;
+    FVector Location = FVector::ZeroVector;
+    // Attenuation radius, 0 when the light has none (directional/sky)
+    float Radius = 0.0f;
+};
+
+// Tagged environment actor (vegetation, grass...) cached in the stealth grid
+struct FStealthCoverEntry {
+    TWeakObjectPtr<AActor> Actor;
+    FVector Location = FVector::ZeroVector;
+    TArray<FName> Tags;
+};
+
+/**
+ * World-level registry of everything the stealth detection needs to know about the environment.
+ * Lights, tagged cover actors and stealth guards are kept in a 2D uniform grid so that per-guard
+ * queries only touch the cells around the query point instead of walking every actor in the world.
+ */
+UCLASS(BlueprintType)
+class PORTAL_API UPortalStealthContextSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    // Subsystem Access
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    static UPortalStealthContextSubsystem* GetInstance(const UObject* WorldContext);
+
+    // Registration
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void RegisterActor(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void UnregisterActor(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void RegisterLight(ULightComponent* Light);
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void UnregisterLight(ULightComponent* Light);
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void RegisterGuard(UACFStealthDetectionComponent* Guard);
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void UnregisterGuard(UACFStealthDetectionComponent* Guard);
+
+    // Queries
+    /** Returns the normalized [0,1] light contribution at Point, considering lights no further than MaxRadius. */
+    UFUNCTION(BlueprintPure, Category = "Stealth Context")
+    float GetLightIntensityAtPoint(const FVector& Point, float MaxRadius) const;
+
+    UFUNCTION(BlueprintPure, Category = "Stealth Context")
+    bool IsPointIlluminated(const FVector& Point, float MaxRadius) const;
+
+    /** True if an actor carrying one of CoverTags is within Radius of Point. */
+    UFUNCTION(BlueprintPure, Category = "Stealth Context")
+    bool IsPointInCover(const FVector& Point, const TArray<FName>& CoverTags, float Radius) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void GetGuardsInRadius(const FVector& Point, float Radius, TArray<UACFStealthDetectionComponent*>& OutGuards) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Stealth Context")
+    void GetPlayerPawns(TArray<APawn*>& OutPlayers) const;
+
+    // Analytics
+    UFUNCTION(BlueprintPure, Category = "Stealth Context")
+    int32 GetRegisteredLightCount() const { return LightCells.Num() + MovableLights.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Stealth Context")
+    int32 GetRegisteredCoverCount() const { return CoverCells.Num() + MovableCover.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Stealth Context")
+    int32 GetRegisteredGuardCount() const { return Guards.Num(); }
+
+private:
+    // Grid cell edge in world units, sized around the usual light/vegetation query radii
+    static constexpr float CellSize = 1000.0f;
+
+    TMap<FIntPoint, TArray<FStealthLightEntry>> LightGrid;
+    TMap<FIntPoint, TArray<FStealthCoverEntry>> CoverGrid;
+
+    // Cell each static entry lives in, for O(1) removal
+    TMap<TWeakObjectPtr<ULightComponent>, FIntPoint> LightCells;
+    TMap<TWeakObjectPtr<AActor>, FIntPoint> CoverCells;
+
+    // Movable lights change position every frame, so they are checked directly
+    TArray<TWeakObjectPtr<ULightComponent>> MovableLights;
+
+    // Pawns and movable cover actors, same as movable lights
+    TArray<TWeakObjectPtr<AActor>> MovableCover;
+
+    // Lights unregistered without their actor are dropped by a periodic prune.
+    // Lights added to an actor after its components were registered must call RegisterLight
+    static constexpr float LightPruneInterval = 1.0f;
+    FTimerHandle LightPruneTimer;
+
+    TArray<TWeakObjectPtr<UACFStealthDetectionComponent>> Guards;
+
+    // Guards move, so their grid is rebuilt lazily at most once per frame
+    mutable TMap<FIntPoint, TArray<TWeakObjectPtr<UACFStealthDetectionComponent>>> GuardGrid;
+    mutable uint64 GuardGridFrame = MAX_uint64;
+
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
+    FDelegateHandle ActorComponentsRegisteredHandle;
+    FDelegateHandle LevelAddedHandle;
+    FDelegateHandle LevelRemovedHandle;
+
+    static FIntPoint GetCell(const FVector& Location);
+    static float GetLightRadius(const ULightComponent* Light);
+    static bool IsMovableActor(const AActor* Actor);
+
+    void IndexLevel(ULevel* Level);
+    void RefreshGuardGrid() const;
+    void PruneLights();
+
+    template <typename Predicate>
+    bool ForEachLightNear(const FVector& Point, float MaxRadius, Predicate&& Pred) const;
+
+    void HandleActorSpawned(AActor* Actor);
+    void HandleActorComponentsRegistered(AActor* Actor);
+    void HandleActorDestroyed(AActor* Actor);
+    void HandleLevelAdded(ULevel* Level, UWorld* World);
+    void HandleLevelRemoved(ULevel* Level, UWorld* World);
+};
@@ -2,8 +2,10 @@
 
 #include "ACFAssaultPoint.h"
 #include "ACFConqueringComponent.h"
+#include "ACFConquestSubsystem.h"
 #include "ACFUnitTypes.h"
 #include "Components/ACFAIWavesMasterComponent.h"
+#include "GameFramework/PlayerController.h"
 #include "Net/UnrealNetwork.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -11,6 +13,18 @@
 void AACFAssaultPoint::SetConqueringState_Implementation(APlayerController* player, EConqueredState newState)
 {
     conqueringState = newState;
+    if (conqueringState == EConqueredState::ENotConquered) {
+        conqueringTeamId = FGenericTeamId::NoTeam.GetId();
+    } else if (player) {
+        // Player controllers usually take the team of their pawn
+        FGenericTeamId playerTeam = FGenericTeamId::GetTeamIdentifier(player);
+        if (playerTeam == FGenericTeamId::NoTeam && player->GetPawn()) {
+            playerTeam = FGenericTeamId::GetTeamIdentifier(player->GetPawn());
+        }
+        conqueringTeamId = playerTeam.GetId();
+    }
+    NotifyConquestSubsystem();
+
     if (player) {
         UACFConqueringComponent* conqComp = GetLocalPlayerConqueringComponent(player);
         if (conqComp) {
@@ -48,6 +62,26 @@ class UACFConqueringComponent* AACFAssaultPoint::GetLocalPlayerConqueringCompone
 void AACFAssaultPoint::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (UACFConquestSubsystem* conquestSubsystem = GetWorld()->GetSubsystem<UACFConquestSubsystem>()) {
+        conquestSubsystem->RegisterAssaultPoint(this);
+    }
+}
+
+void AACFAssaultPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UACFConquestSubsystem* conquestSubsystem = GetWorld()->GetSubsystem<UACFConquestSubsystem>()) {
+        conquestSubsystem->UnregisterAssaultPoint(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AACFAssaultPoint::NotifyConquestSubsystem()
+{
+    if (UACFConquestSubsystem* conquestSubsystem = GetWorld()->GetSubsystem<UACFConquestSubsystem>()) {
+        conquestSubsystem->NotifyConqueringStateChanged(this);
+    }
 }
 
 void AACFAssaultPoint::OnConquestStarted_Implementation()
@@ -64,17 +98,33 @@ void AACFAssaultPoint::OnConquestInterrupted_Implementation()
 
 void AACFAssaultPoint::OnLoaded_Implementation()
 {
-   
-    SetConqueringState( UGameplayStatics::GetPlayerController(this, 0), conqueringState);
+    // The loaded team is kept, it is not necessarily the one of the local player
+    NotifyConquestSubsystem();
+
+    if (APlayerController* player = UGameplayStatics::GetPlayerController(this, 0)) {
+        UACFConqueringComponent* conqComp = GetLocalPlayerConqueringComponent(player);
+        if (conqComp) {
+            conqComp->SetConqueringState(AssaultPointTag, conqueringState);
+        }
+    }
+    OnConquerStateChanged.Broadcast(conqueringState);
 }
 
 void AACFAssaultPoint::OnRep_ConqueringState()
 {
+    NotifyConquestSubsystem();
     OnConquerStateChanged.Broadcast(conqueringState);
 }
 
+void AACFAssaultPoint::OnRep_ConqueringTeam()
+{
+    // The subsystem ignores the notification if the state OnRep already reported this team
+    NotifyConquestSubsystem();
+}
+
 void AACFAssaultPoint::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(AACFAssaultPoint, conqueringState);
+    DOREPLIFETIME(AACFAssaultPoint, conqueringTeamId);
 }
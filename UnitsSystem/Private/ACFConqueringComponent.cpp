@@ -2,7 +2,8 @@
 
 #include "ACFConqueringComponent.h"
 #include "ACFAssaultPoint.h"
-#include "Kismet/GameplayStatics.h"
+#include "ACFConquestSubsystem.h"
+#include "Engine/World.h"
 #include "Net/UnrealNetwork.h"
 
 // Sets default values for this component's properties
@@ -30,9 +31,9 @@ void UACFConqueringComponent::SetConqueringState_Implementation(const FGameplayT
 
 EConqueredState UACFConqueringComponent::GetConqueringStateForPoint(const FGameplayTag& point) const
 {
-    AACFAssaultPoint* assPoint = GetAssaultPoint(point);
-    if (assPoint) {
-        return assPoint->GetConqueringState();
+    const UACFConquestSubsystem* conquestSubsystem = GetWorld()->GetSubsystem<UACFConquestSubsystem>();
+    if (conquestSubsystem && conquestSubsystem->GetAssaultPoint(point)) {
+        return conquestSubsystem->GetConqueringState(point);
     }
     UE_LOG(LogTemp, Warning, TEXT("Missing Assault Point! - UACFConqueringComponent::GetConqueringStateForPoint "));
 
@@ -46,13 +47,10 @@ bool UACFConqueringComponent::IsAnyConquerInProgress() const
 
 class AACFAssaultPoint* UACFConqueringComponent::GetAssaultPoint(const FGameplayTag& point) const
 {
-    TArray<AActor*> outActors;
-    UGameplayStatics::GetAllActorsOfClass(this, AACFAssaultPoint::StaticClass(), outActors);
-    for (AActor* actor : outActors) {
-        AACFAssaultPoint* assPoint = Cast<AACFAssaultPoint>(actor);
-        if (assPoint && assPoint->GetAssaultPointTag() == point) {
-            return assPoint;
-        }
+    const UACFConquestSubsystem* conquestSubsystem = GetWorld()->GetSubsystem<UACFConquestSubsystem>();
+    AACFAssaultPoint* assPoint = conquestSubsystem ? conquestSubsystem->GetAssaultPoint(point) : nullptr;
+    if (assPoint) {
+        return assPoint;
     }
     UE_LOG(LogTemp, Warning, TEXT("Missing Assault Point! -  UACFConqueringComponent::GetAssaultPoint"));
 
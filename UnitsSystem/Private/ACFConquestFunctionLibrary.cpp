@@ -2,6 +2,9 @@
 
 #include "ACFConquestFunctionLibrary.h"
 #include "ACFConqueringComponent.h"
+#include "ACFConquestSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -19,11 +22,12 @@ UACFConqueringComponent* UACFConquestFunctionLibrary::GetLocalConqueringComponen
 
 AACFAssaultPoint* UACFConquestFunctionLibrary::GetAssaultPoint(const UObject* WorldContextObject, const FGameplayTag& pointTag)
 {
-    const UACFConqueringComponent* conquerComp = UACFConquestFunctionLibrary::GetLocalConqueringComponent(WorldContextObject);
-    if (conquerComp) {
-        return conquerComp->GetAssaultPoint(pointTag);
+    const UWorld* world = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    const UACFConquestSubsystem* conquestSubsystem = world ? world->GetSubsystem<UACFConquestSubsystem>() : nullptr;
+    if (conquestSubsystem) {
+        return conquestSubsystem->GetAssaultPoint(pointTag);
     }
-    UE_LOG(LogTemp, Warning, TEXT("Missing Conquer Component from player Controller! - UACFConquestFunctionLibrary::GetLocalConqueringComponent "));
+    UE_LOG(LogTemp, Warning, TEXT("Missing Conquest Subsystem! - UACFConquestFunctionLibrary::GetAssaultPoint "));
 
     return nullptr;
 }
@@ -0,0 +1,141 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFConquestSubsystem.h"
+#include "ACFAssaultPoint.h"
+
+void UACFConquestSubsystem::Deinitialize()
+{
+    AssaultPoints.Empty();
+    TeamStates.Empty();
+    for (int32& num : StateNums) {
+        num = 0;
+    }
+
+    Super::Deinitialize();
+}
+
+void UACFConquestSubsystem::RegisterAssaultPoint(AACFAssaultPoint* assaultPoint)
+{
+    if (!assaultPoint) {
+        return;
+    }
+
+    const FGameplayTag pointTag = assaultPoint->GetAssaultPointTag();
+    if (!pointTag.IsValid()) {
+        UE_LOG(LogTemp, Warning, TEXT("Assault Point without tag! - UACFConquestSubsystem::RegisterAssaultPoint"));
+        return;
+    }
+
+    FAssaultPointEntry* entry = AssaultPoints.Find(pointTag);
+    if (entry && entry->AssaultPoint.IsValid()) {
+        if (entry->AssaultPoint != assaultPoint) {
+            UE_LOG(LogTemp, Warning, TEXT("Duplicated Assault Point tag %s! - UACFConquestSubsystem::RegisterAssaultPoint"), *pointTag.ToString());
+        }
+        return;
+    }
+
+    if (entry) {
+        // The previous point was destroyed without unregistering
+        UpdateAggregates(entry->State, entry->Team, -1);
+    } else {
+        entry = &AssaultPoints.Add(pointTag);
+    }
+
+    entry->AssaultPoint = assaultPoint;
+    entry->State = assaultPoint->GetConqueringState();
+    entry->Team = assaultPoint->GetConqueringTeam();
+    UpdateAggregates(entry->State, entry->Team, 1);
+}
+
+void UACFConquestSubsystem::UnregisterAssaultPoint(AACFAssaultPoint* assaultPoint)
+{
+    if (!assaultPoint) {
+        return;
+    }
+
+    const FGameplayTag pointTag = assaultPoint->GetAssaultPointTag();
+    const FAssaultPointEntry* entry = AssaultPoints.Find(pointTag);
+    if (entry && entry->AssaultPoint == assaultPoint) {
+        UpdateAggregates(entry->State, entry->Team, -1);
+        AssaultPoints.Remove(pointTag);
+    }
+}
+
+void UACFConquestSubsystem::NotifyConqueringStateChanged(AACFAssaultPoint* assaultPoint)
+{
+    if (!assaultPoint) {
+        return;
+    }
+
+    const FGameplayTag pointTag = assaultPoint->GetAssaultPointTag();
+    FAssaultPointEntry* entry = AssaultPoints.Find(pointTag);
+    if (!entry || entry->AssaultPoint != assaultPoint) {
+        return;
+    }
+
+    const EConqueredState newState = assaultPoint->GetConqueringState();
+    const FGenericTeamId newTeam = assaultPoint->GetConqueringTeam();
+    if (entry->State == newState && entry->Team == newTeam) {
+        return;
+    }
+
+    const FGenericTeamId oldTeam = entry->Team;
+    const bool bOldTeamChanged = UpdateAggregates(entry->State, oldTeam, -1);
+    entry->State = newState;
+    entry->Team = newTeam;
+    const bool bNewTeamChanged = UpdateAggregates(newState, newTeam, 1);
+
+    OnConquerStateChanged.Broadcast(pointTag, newState);
+    if (bOldTeamChanged) {
+        OnTeamConquestChanged.Broadcast(oldTeam);
+    }
+    if (bNewTeamChanged && (newTeam != oldTeam || !bOldTeamChanged)) {
+        OnTeamConquestChanged.Broadcast(newTeam);
+    }
+}
+
+AACFAssaultPoint* UACFConquestSubsystem::GetAssaultPoint(const FGameplayTag& pointTag) const
+{
+    const FAssaultPointEntry* entry = AssaultPoints.Find(pointTag);
+    return entry ? entry->AssaultPoint.Get() : nullptr;
+}
+
+EConqueredState UACFConquestSubsystem::GetConqueringState(const FGameplayTag& pointTag) const
+{
+    const FAssaultPointEntry* entry = AssaultPoints.Find(pointTag);
+    return entry ? entry->State : EConqueredState::ENotConquered;
+}
+
+FGenericTeamId UACFConquestSubsystem::GetConqueringTeam(const FGameplayTag& pointTag) const
+{
+    const FAssaultPointEntry* entry = AssaultPoints.Find(pointTag);
+    return entry ? entry->Team : FGenericTeamId::NoTeam;
+}
+
+FACFTeamConquestState UACFConquestSubsystem::GetTeamConquestState(const FGenericTeamId& team) const
+{
+    const FACFTeamConquestState* teamState = TeamStates.Find(team.GetId());
+    return teamState ? *teamState : FACFTeamConquestState();
+}
+
+int32 UACFConquestSubsystem::GetAssaultPointsNumInState(EConqueredState state) const
+{
+    return StateNums[static_cast<uint8>(state)];
+}
+
+bool UACFConquestSubsystem::UpdateAggregates(EConqueredState state, const FGenericTeamId& team, int32 delta)
+{
+    StateNums[static_cast<uint8>(state)] += delta;
+
+    if (team == FGenericTeamId::NoTeam || state == EConqueredState::ENotConquered) {
+        return false;
+    }
+
+    FACFTeamConquestState& teamState = TeamStates.FindOrAdd(team.GetId());
+    if (state == EConqueredState::EConquerInProgress) {
+        teamState.ConquerInProgressNum += delta;
+    } else {
+        teamState.ConqueredNum += delta;
+    }
+    return true;
+}
@@ -0,0 +1,32 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#include "ACFUnitArray.h"
+#include "ACFUnitsComponent.h"
+
+void FACFUnitItem::PreReplicatedRemove(const FACFUnitArray& InArraySerializer)
+{
+    if (InArraySerializer.Owner) {
+        InArraySerializer.Owner->HandleUnitRemoved(Unit);
+    }
+}
+
+void FACFUnitItem::PostReplicatedAdd(const FACFUnitArray& InArraySerializer)
+{
+    if (InArraySerializer.Owner) {
+        InArraySerializer.Owner->HandleUnitAdded(Unit);
+    }
+}
+
+void FACFUnitItem::PostReplicatedChange(const FACFUnitArray& InArraySerializer)
+{
+    if (InArraySerializer.Owner) {
+        InArraySerializer.Owner->HandleUnitChanged(Unit);
+    }
+}
+
+void FACFUnitArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (Owner) {
+        Owner->DispatchUnitsChanged();
+    }
+}
@@ -23,28 +23,64 @@ void UACFUnitsComponent::BeginPlay()
     // ...
 }
 
+void UACFUnitsComponent::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    // Set after the archetype copy, so every instance points to itself
+    UnitItems.Owner = this;
+}
+
+void UACFUnitsComponent::PostLoad()
+{
+    Super::PostLoad();
+
+    MoveLegacyUnits();
+}
+
+void UACFUnitsComponent::OnComponentLoaded_Implementation()
+{
+    MoveLegacyUnits();
+
+    // Loaded items were not marked dirty, the whole roster is sent again
+    UnitItems.MarkArrayDirty();
+}
+
 void UACFUnitsComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(UACFUnitsComponent, Units);
+    DOREPLIFETIME(UACFUnitsComponent, UnitItems);
+}
+
+TArray<FBaseUnit> UACFUnitsComponent::GetUnits() const
+{
+    TArray<FBaseUnit> outUnits;
+    outUnits.Reserve(UnitItems.Items.Num());
+    for (const FACFUnitItem& item : UnitItems.Items) {
+        outUnits.Add(item.Unit);
+    }
+    return outUnits;
 }
 
 void UACFUnitsComponent::AddUnit(const TSubclassOf<AACFCharacter>& unit)
 {
-    const FBaseUnit newUnit = FBaseUnit(unit);
-    Units.Add(newUnit);
-   
-    OnUnitAdded.Broadcast(newUnit);
-    OnUnitsChanged.Broadcast(Units);
+    FACFUnitItem& newItem = UnitItems.Items.Add_GetRef(FACFUnitItem(FBaseUnit(unit)));
+    UnitItems.MarkItemDirty(newItem);
+
+    HandleUnitAdded(newItem.Unit);
+    DispatchUnitsChanged();
 }
 
 bool UACFUnitsComponent::RemoveUnit(const TSubclassOf<AACFCharacter>& unit)
 {
-    if (Units.Contains(unit)) {
+    const int32 index = UnitItems.IndexOf(unit);
+    if (index != INDEX_NONE) {
+        const FBaseUnit removedUnit = UnitItems.Items[index].Unit;
+        UnitItems.Items.RemoveAt(index);
+        UnitItems.MarkArrayDirty();
 
-        Units.RemoveSingle(unit);
-        OnUnitRemoved.Broadcast(FBaseUnit(unit));
-        OnUnitsChanged.Broadcast(Units);
+        HandleUnitRemoved(removedUnit);
+        DispatchUnitsChanged();
         return true;
     }
     return false;
@@ -52,7 +88,7 @@ bool UACFUnitsComponent::RemoveUnit(const TSubclassOf<AACFCharacter>& unit)
 
 bool UACFUnitsComponent::MoveUnitToGroup(const TSubclassOf<AACFCharacter>& unit, UACFGroupAIComponent* groupAI)
 {
-    if (groupAI && Units.Contains(unit) && groupAI->AddAIToSpawnFromClass(unit)) {
+    if (groupAI && ContainsUnit(unit) && groupAI->AddAIToSpawnFromClass(unit)) {
         RemoveUnit(unit);
         return true;
     }
@@ -68,7 +104,47 @@ bool UACFUnitsComponent::MoveUnitFromGroup(const TSubclassOf<AACFCharacter>& uni
     return false;
 }
 
-void UACFUnitsComponent::OnRepUnits()
+void UACFUnitsComponent::HandleUnitAdded(const FBaseUnit& unit)
 {
-    OnUnitsChanged.Broadcast(Units);
+    pendingAddedUnits.Add(unit);
+    OnUnitAdded.Broadcast(unit);
+}
+
+void UACFUnitsComponent::HandleUnitRemoved(const FBaseUnit& unit)
+{
+    pendingRemovedUnits.Add(unit);
+    OnUnitRemoved.Broadcast(unit);
+}
+
+void UACFUnitsComponent::HandleUnitChanged(const FBaseUnit& unit)
+{
+    pendingChangedUnits.Add(unit);
+    OnUnitChanged.Broadcast(unit);
+}
+
+void UACFUnitsComponent::DispatchUnitsChanged()
+{
+    if (pendingAddedUnits.Num() == 0 && pendingRemovedUnits.Num() == 0 && pendingChangedUnits.Num() == 0) {
+        return;
+    }
+
+    OnUnitsChanged.Broadcast(pendingAddedUnits, pendingRemovedUnits, pendingChangedUnits);
+    pendingAddedUnits.Reset();
+    pendingRemovedUnits.Reset();
+    pendingChangedUnits.Reset();
+}
+
+void UACFUnitsComponent::MoveLegacyUnits()
+{
+    if (Units.Num() == 0) {
+        return;
+    }
+
+    // The old roster replaces the default one, as it did when it was loaded
+    UnitItems.Items.Reset(Units.Num());
+    for (const FBaseUnit& unit : Units) {
+        UnitItems.Items.Add(FACFUnitItem(unit));
+    }
+    Units.Empty();
+    UnitItems.MarkArrayDirty();
 }
@@ -6,6 +6,7 @@
 #include "ALSSavableInterface.h"
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "GenericTeamAgentInterface.h"
 #include "Groups/ACFAIWaveMaster.h"
 
 #include "ACFAssaultPoint.generated.h"
@@ -42,6 +43,13 @@ public:
         return conqueringState;
     }
 
+    /*Team of the player that is conquering or has conquered this point, NoTeam if it is not conquered*/
+    UFUNCTION(BlueprintPure, Category = ACF)
+    FGenericTeamId GetConqueringTeam() const
+    {
+        return FGenericTeamId(conqueringTeamId);
+    }
+
     UFUNCTION(BlueprintPure, Category = ACF)
     bool CanStartConquering() const
     {
@@ -59,6 +67,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     UFUNCTION(BlueprintNativeEvent, Category = ACF)
     void OnConquestStarted();
@@ -81,6 +90,15 @@ private:
     UPROPERTY(SaveGame, ReplicatedUsing = OnRep_ConqueringState)
     EConqueredState conqueringState;
 
+    /*Id of the conquering team, FGenericTeamId has no SaveGame member so it is stored as its raw id*/
+    UPROPERTY(SaveGame, ReplicatedUsing = OnRep_ConqueringTeam)
+    uint8 conqueringTeamId = FGenericTeamId::NoTeam.GetId();
+
     UFUNCTION()
     void OnRep_ConqueringState();
+
+    UFUNCTION()
+    void OnRep_ConqueringTeam();
+
+    void NotifyConquestSubsystem();
 };
@@ -2,14 +2,13 @@
 
 #pragma once
 
+#include "ACFUnitTypes.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 
 #include "ACFConqueringComponent.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAssaultPointConquerStateChanged, const FGameplayTag&, assaultPoint, const EConqueredState&, newState);
-
 UCLASS(ClassGroup = (ACF), meta = (BlueprintSpawnableComponent))
 class UNITSSYSTEM_API UACFConqueringComponent : public UActorComponent {
     GENERATED_BODY()
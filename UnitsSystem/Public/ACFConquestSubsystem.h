@@ -0,0 +1,77 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFUnitTypes.h"
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GenericTeamAgentInterface.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ACFConquestSubsystem.generated.h"
+
+class AACFAssaultPoint;
+
+/**
+ * Registry of the AACFAssaultPoint of the world, indexed by their assault point tag.
+ * Points register themselves on BeginPlay and notify every change of their conquering state, on the
+ * server and on clients, so the subsystem keeps the state of each point and the number of points each
+ * team is conquering or has conquered. Every query is a lookup, UI and AI can poll them every frame.
+ */
+UCLASS()
+class UNITSSYSTEM_API UACFConquestSubsystem : public UWorldSubsystem {
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    void RegisterAssaultPoint(AACFAssaultPoint* assaultPoint);
+
+    void UnregisterAssaultPoint(AACFAssaultPoint* assaultPoint);
+
+    /*Called by the point when its state or its conquering team changes*/
+    void NotifyConqueringStateChanged(AACFAssaultPoint* assaultPoint);
+
+    UFUNCTION(BlueprintPure, Category = ACF)
+    AACFAssaultPoint* GetAssaultPoint(const FGameplayTag& pointTag) const;
+
+    UFUNCTION(BlueprintPure, Category = ACF)
+    EConqueredState GetConqueringState(const FGameplayTag& pointTag) const;
+
+    /*Team that is conquering or has conquered the point, NoTeam if it is not conquered*/
+    UFUNCTION(BlueprintPure, Category = ACF)
+    FGenericTeamId GetConqueringTeam(const FGameplayTag& pointTag) const;
+
+    UFUNCTION(BlueprintPure, Category = ACF)
+    FACFTeamConquestState GetTeamConquestState(const FGenericTeamId& team) const;
+
+    UFUNCTION(BlueprintPure, Category = ACF)
+    int32 GetAssaultPointsNumInState(EConqueredState state) const;
+
+    UFUNCTION(BlueprintPure, Category = ACF)
+    bool IsAnyConquerInProgress() const { return GetAssaultPointsNumInState(EConqueredState::EConquerInProgress) > 0; }
+
+    UPROPERTY(BlueprintAssignable, Category = ACF)
+    FOnAssaultPointConquerStateChanged OnConquerStateChanged;
+
+    /*Broadcasted when the conquest state of a team changes*/
+    UPROPERTY(BlueprintAssignable, Category = ACF)
+    FOnTeamConquestChanged OnTeamConquestChanged;
+
+private:
+    struct FAssaultPointEntry {
+        TWeakObjectPtr<AACFAssaultPoint> AssaultPoint;
+        EConqueredState State = EConqueredState::ENotConquered;
+        FGenericTeamId Team = FGenericTeamId::NoTeam;
+    };
+
+    TMap<FGameplayTag, FAssaultPointEntry> AssaultPoints;
+
+    TMap<uint8, FACFTeamConquestState> TeamStates;
+
+    /*Points in each EConqueredState, indexed by its value*/
+    int32 StateNums[4] = { 0, 0, 0, 0 };
+
+    /*Adds or removes the contribution of a point to the aggregates, returns whether a team one changed*/
+    bool UpdateAggregates(EConqueredState state, const FGenericTeamId& team, int32 delta);
+};
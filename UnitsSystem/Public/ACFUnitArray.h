@@ -0,0 +1,65 @@
+// Copyright (C) Developed by Pask, Published by Dark Tower Interactive SRL 2024. All Rights Reserved.
+
+#pragma once
+
+#include "ACFAITypes.h"
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+
+#include "ACFUnitArray.generated.h"
+
+class UACFUnitsComponent;
+struct FACFUnitArray;
+
+USTRUCT()
+struct FACFUnitItem : public FFastArraySerializerItem {
+    GENERATED_BODY()
+
+public:
+    FACFUnitItem() { }
+    FACFUnitItem(const FBaseUnit& inUnit)
+        : Unit(inUnit)
+    {
+    }
+
+    UPROPERTY(EditAnywhere, SaveGame, Category = ACF)
+    FBaseUnit Unit;
+
+    void PreReplicatedRemove(const FACFUnitArray& InArraySerializer);
+    void PostReplicatedAdd(const FACFUnitArray& InArraySerializer);
+    void PostReplicatedChange(const FACFUnitArray& InArraySerializer);
+};
+
+/**
+ * Roster of a UACFUnitsComponent. Only the units added, removed or changed since the last update are
+ * replicated, and clients are notified of each of them followed by a single batched notification.
+ */
+USTRUCT()
+struct FACFUnitArray : public FFastArraySerializer {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, SaveGame, Category = ACF)
+    TArray<FACFUnitItem> Items;
+
+    UACFUnitsComponent* Owner = nullptr;
+
+    int32 IndexOf(const TSubclassOf<AACFCharacter>& unitClass) const
+    {
+        return Items.IndexOfByPredicate([&unitClass](const FACFUnitItem& item) { return item.Unit == unitClass; });
+    }
+
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FACFUnitItem, FACFUnitArray>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FACFUnitArray> : public TStructOpsTypeTraitsBase2<FACFUnitArray> {
+    enum {
+        WithNetDeltaSerializer = true,
+    };
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GenericTeamAgentInterface.h"
 
 #include "ACFUnitTypes.generated.h"
 
@@ -18,6 +20,22 @@ enum class EConqueredState : uint8 {
     EConquered = 3 UMETA(DisplayName = "Conquered"),
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAssaultPointConquerStateChanged, const FGameplayTag&, assaultPoint, const EConqueredState&, newState);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTeamConquestChanged, const FGenericTeamId&, team);
+
+/*Assault points of a team in each conquest state*/
+USTRUCT(BlueprintType)
+struct FACFTeamConquestState {
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    int32 ConquerInProgressNum = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = ACF)
+    int32 ConqueredNum = 0;
+};
+
 UCLASS()
 class UNITSSYSTEM_API UACFUnitTypes : public UObject {
     GENERATED_BODY()
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ACFAITypes.h"
+#include "ACFUnitArray.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
 
@@ -11,9 +12,10 @@
 class AACFCharacter;
 class UACFGroupAIComponent;
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUnitsChanged, const TArray<FBaseUnit>&, newUnits);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnUnitsChanged, const TArray<FBaseUnit>&, addedUnits, const TArray<FBaseUnit>&, removedUnits, const TArray<FBaseUnit>&, changedUnits);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUnitAdded, const FBaseUnit&, newUnit);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUnitRemoved, const FBaseUnit&, Unit);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUnitChanged, const FBaseUnit&, Unit);
 
 
 UCLASS(ClassGroup = (ACF), meta = (BlueprintSpawnableComponent))
@@ -28,17 +30,50 @@ protected:
     // Called when the game starts
     virtual void BeginPlay() override;
 
-    UPROPERTY(EditAnywhere, Savegame, BlueprintReadOnly, ReplicatedUsing = OnRepUnits, Category = ACF)
+    virtual void PostInitProperties() override;
+
+    virtual void PostLoad() override;
+
+    UPROPERTY(EditAnywhere, Savegame, Replicated, Category = ACF)
+    FACFUnitArray UnitItems;
+
+    /*Roster of saves and assets made before UnitItems, keeps the old name so they still load into it.
+     Moved into UnitItems once loaded, never add units here*/
+    UPROPERTY(Savegame)
     TArray<FBaseUnit> Units;
 
+    /*Called when the component is loaded*/
+    UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = ACF)
+    void OnComponentLoaded();
 
 public:
+    /*Copy of the roster for blueprints, native code should use GetUnitsView*/
+    UFUNCTION(BlueprintPure, Category = ACF)
+    TArray<FBaseUnit> GetUnits() const;
+
+    TConstArrayView<FACFUnitItem> GetUnitsView() const
+    {
+        return UnitItems.Items;
+    }
+
+    const FBaseUnit& GetUnit(int32 index) const
+    {
+        return UnitItems.Items[index].Unit;
+    }
+
     UFUNCTION(BlueprintPure, Category = ACF)
-    TArray<FBaseUnit> GetUnits() const
+    int32 GetUnitsNum() const
     {
-        return Units;
+        return UnitItems.Items.Num();
     }
 
+    UFUNCTION(BlueprintPure, Category = ACF)
+    bool ContainsUnit(const TSubclassOf<AACFCharacter>& unit) const
+    {
+        return UnitItems.IndexOf(unit) != INDEX_NONE;
+    }
+
+    /*Broadcasted once per update with only the units that changed*/
     UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnUnitsChanged OnUnitsChanged;
 
@@ -48,6 +83,9 @@ public:
        UPROPERTY(BlueprintAssignable, Category = ACF)
     FOnUnitRemoved OnUnitRemoved;
 
+    UPROPERTY(BlueprintAssignable, Category = ACF)
+    FOnUnitChanged OnUnitChanged;
+
     UFUNCTION(BlueprintCallable, Category = ACF)
     void AddUnit(const TSubclassOf<AACFCharacter>& unit);
 
@@ -61,6 +99,19 @@ public:
     bool MoveUnitFromGroup(const TSubclassOf<AACFCharacter>& unit, UACFGroupAIComponent* groupAI);
 
 private:
-    UFUNCTION()
-    void OnRepUnits();
+    friend struct FACFUnitItem;
+    friend struct FACFUnitArray;
+
+    // Units notified since the last OnUnitsChanged
+    TArray<FBaseUnit> pendingAddedUnits;
+    TArray<FBaseUnit> pendingRemovedUnits;
+    TArray<FBaseUnit> pendingChangedUnits;
+
+    void HandleUnitAdded(const FBaseUnit& unit);
+    void HandleUnitRemoved(const FBaseUnit& unit);
+    void HandleUnitChanged(const FBaseUnit& unit);
+
+    void DispatchUnitsChanged();
+
+    void MoveLegacyUnits();
 };
@@ -18,7 +18,8 @@ public class UnitsSystem : ModuleRules
                 "AscentCoreInterfaces",
                 "AIFramework",
 				"AscentSaveSystem",
-                  "GameplayTags"
+                  "GameplayTags",
+                "NetCore"
             });
 
         PrivateDependencyModuleNames.AddRange(